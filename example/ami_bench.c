@@ -0,0 +1,104 @@
+/**
+ * Benchmark of AMI packets parsing in different packet memory modes.
+ * Counts memory allocations per parsed and destroyed packet.
+ * Build with "make -f example.mk ami_bench".
+ */
+#include <stdio.h>
+#include <time.h>
+#include <amip.h>
+
+#define ITERATIONS 200000
+
+static unsigned long allocs = 0;
+
+// linker wraps: -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t nmemb, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+  allocs++;
+  return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t nmemb, size_t size)
+{
+  allocs++;
+  return __real_calloc(nmemb, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+  allocs++;
+  return __real_realloc(ptr, size);
+}
+
+static const char packet[] = "Event: Newchannel\r\n"
+                             "Privilege: call,all\r\n"
+                             "Channel: SIP/ipauthTp3BCHH7-00573401\r\n"
+                             "ChannelState: 0\r\n"
+                             "ChannelStateDesc: Down\r\n"
+                             "CallerIDNum: 18007472020\r\n"
+                             "CallerIDName: <unknown>\r\n"
+                             "ConnectedLineNum: <unknown>\r\n"
+                             "ConnectedLineName: <unknown>\r\n"
+                             "Language: en\r\n"
+                             "AccountCode: \r\n"
+                             "Context: from-trunk\r\n"
+                             "Exten: 5145551234\r\n"
+                             "Priority: 1\r\n"
+                             "Uniqueid: 1486254977.6071371\r\n"
+                             "Linkedid: 1486254977.6071371\r\n\r\n";
+
+static void bench(const char *title, enum pack_mode mode)
+{
+  struct timespec start, end;
+  unsigned long before = allocs;
+  double ns;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int i = 0; i < ITERATIONS; i++) {
+    AMIPacket *pack = amiparse_pack_n(packet, sizeof(packet) - 1, mode);
+    amiheader_value(pack, Channel);
+    amipack_destroy(pack);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+  printf("%-8s %8.1f allocs/packet %10.1f ns/packet\n", title,
+         (double)(allocs - before) / ITERATIONS, ns / ITERATIONS);
+}
+
+static void bench_pool(const char *title, enum pack_mode mode)
+{
+  struct timespec start, end;
+  AMIPackPool *pool = amipool_init(mode, 8);
+  unsigned long before = allocs;
+  double ns;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int i = 0; i < ITERATIONS; i++) {
+    AMIPacket *pack = amiparse_pack_pool(pool, packet, sizeof(packet) - 1);
+    amiheader_value(pack, Channel);
+    amipool_put(pool, pack);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+  printf("%-8s %8.1f allocs/packet %10.1f ns/packet\n", title,
+         (double)(allocs - before) / ITERATIONS, ns / ITERATIONS);
+  amipool_destroy(pool);
+}
+
+int main(int argc, const char *argv[])
+{
+  printf("== Parse %d packets of %d headers ==\n", ITERATIONS, 16);
+  bench("heap",  AMIPACK_HEAP);
+  bench("arena", AMIPACK_ARENA);
+  bench("view",  AMIPACK_VIEW);
+  bench("lazy",  AMIPACK_LAZY);
+  bench_pool("pool",  AMIPACK_ARENA);
+  bench_pool("hpool", AMIPACK_HEAP);
+  return 0;
+}
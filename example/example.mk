@@ -3,6 +3,9 @@ LDFLAGS=-Wall -lamip -L../src/ -I../src/
 ami_example: ami_example.c
 	$(CC) -o $@ $< $(LDFLAGS)
 
+ami_bench: ami_bench.c
+	$(CC) -O2 -o $@ $< $(LDFLAGS) -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc
+
 .PHONY: clean
 clean:
-	rm -f ami_example
+	rm -f ami_example ami_bench
@@ -27,7 +27,6 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <assert.h>
 
 #include <stdio.h>
 
@@ -37,54 +36,180 @@
  * Macro to detect if given header type is valid.
  * @param type      Header type
  */
-#define valid_hdr_type(type) (type > 0 && type <= (sizeof(header_type_name)/sizeof(char*)))
+#define valid_hdr_type(type) (type > 0 && type < HDR_CUSTOM + custom_hdr_count)
+
+/**
+ * Macro to get name string of header type.
+ * @param type      Valid header type
+ */
+#define hdr_type_str(type) \
+  ((type) < HDR_CUSTOM ? &header_type_str[type] : &custom_hdr_str[(type) - HDR_CUSTOM])
+
+/**
+ * Macro to detect if header name is a name from header types table.
+ * @param type      Header type
+ * @param name      Header name
+ */
+#define known_hdr_name(type, name) (valid_hdr_type(type) && (name) == hdr_type_str(type)->buf)
+
+/*! String structure initializer with length computed at compile time. */
+#define STR(s) { (char *) s, sizeof(s) - 1 }
+
+/*! Default size of packet memory block. */
+#define MEM_BLOCK_SIZE 2048
+
+/*! Alignment of chunks allocated in packet memory. */
+#define MEM_ALIGN (2 * sizeof(void*))
+
+/*! Round size up to packet memory alignment. */
+#define mem_align(size) (((size) + MEM_ALIGN - 1) & ~(MEM_ALIGN - 1))
+
+/*!
+ * Initial slots and types arrays of packet in modes other than AMIPACK_HEAP
+ * allocated together with packet. Arrays are allocated only when they grow.
+ */
+#define pack_inline_slots(pack) \
+  ((struct hdr_slot *)((char *)(pack) + mem_align (sizeof (AMIPacket))))
+
+/*! Packet slots and types arrays are allocated together with packet. */
+#define pack_slots_inline(pack) \
+  ((pack)->mode != AMIPACK_HEAP && (pack)->slots == pack_inline_slots (pack))
+
+/*! Size of initial slots and types arrays allocated together with packet. */
+#define INLINE_SLOTS_SIZE mem_align (SLOTS_SIZE * (sizeof (struct hdr_slot) + 1))
+
+/*! First memory block of AMIPACK_ARENA packet allocated together with packet. */
+#define pack_first_block(pack) \
+  ((struct mem_block *)((char *)pack_inline_slots (pack) + INLINE_SLOTS_SIZE))
+
+/*!
+ * Packet memory block. Blocks are linked in list and freed with packet.
+ * Chunks are allocated from block data that follows the structure.
+ */
+struct mem_block {
+  struct mem_block  *next; /*!< Next block in list. */
+  size_t            size;  /*!< Block data size. */
+  size_t            used;  /*!< Used bytes of block data. */
+};
+
+static void *amipack_alloc (AMIPacket *pack, size_t size);
+
+/*! Initial size of packet headers slots array. */
+#define SLOTS_SIZE 32
+
+/*! Maximum slot index stored in packet first header slots table. */
+#define SLOT_FIRST_MAX 0xffff
+
+/*! Minimum size of packet names index. */
+#define NAMES_INDEX_SIZE 64
+
+/*! Lower case of ASCII character. */
+#define ascii_lower(c) ((c) >= 'A' && (c) <= 'Z' ? (c) + ('a' - 'A') : (c))
+
+/*! Header type stored in packet dense types array. */
+#define slot_type(type) ((type) >= 0 && (type) < AMIHDR_SET_BITS ? (type) : HDR_UNKNOWN)
+
+/*!
+ * Packet header slot. Slots of packet headers are stored in one array
+ * in packet order, headers types are stored in separate dense array.
+ * AMIPACK_LAZY packet header is created only when it is requested.
+ */
+struct hdr_slot {
+  AMIHeader   *hdr;       /*!< Header or NULL if it is not created yet. */
+  const char  *name;      /*!< Header name. */
+  size_t      name_len;   /*!< Header name length. */
+  const char  *value;     /*!< Header value. */
+  size_t      value_len;  /*!< Header value length. */
+  int         next;       /*!< Slot of next header of the same type or 0 if last
+                               or not indexed. */
+};
+
+/*! Default allocator functions. */
+static void *libc_alloc (size_t size, void *ud) { (void) ud; return malloc (size); }
+static void *libc_realloc (void *ptr, size_t size, void *ud) { (void) ud; return realloc (ptr, size); }
+static void libc_free (void *ptr, void *ud) { (void) ud; free (ptr); }
+
+/*! Allocator used for all library allocations. */
+static AMIAllocator allocator = { libc_alloc, libc_realloc, libc_free, NULL };
 
 static const char *pack_type_name[] = {
   "AMI_UNKNOWN", "AMI_PROMPT", "AMI_ACTION", "AMI_EVENT", "AMI_RESPONSE"
 };
 
-static const char *header_type_name[] = {
+static struct str header_type_str[] = {
 //{{{
-  "UNKNOWN",               "CodecOrder",            "LastApplication",       "RemoteStationID",
-  "ACL",                   "Codecs",                "LastCall",              "Resolution",
-  "AMAflags",              "Command",               "LastData",              "Response",
-  "Account",               "ConnectedLineName",     "Link",                  "Restart",
-  "AccountCode",           "ConnectedLineNum",      "ListItems",             "SIPLastMsg",
-  "Action",                "Context",               "LocalStationID",        "SIP-AuthInsecure",
-  "Address",               "Count",                 "Location",              "SIP-FromDomain",
-  "Address-IP",            "Data",                  "Loginchan",             "SIP-FromUser",
-  "Address-Port",          "Default-Username",      "Logintime",             "SIP-NatSupport",
-  "Agent",                 "Default-addr-IP",       "MD5SecretExist",        "Seconds",
-  "AnswerTime",            "DestUniqueID",          "MOHSuggest",            "Secret",
-  "Append",                "Destination",           "Mailbox",               "SecretExist",
-  "Application",           "DestinationChannel",    "Membership",            "Shutdown",
-  "Async",                 "DestinationContext",    "Message",               "Source",
-  "AuthType",              "DialStatus",            "Mix",                   "SrcUniqueID",
-  "BillableSeconds",       "Dialstring",            "NewMessages",           "StartTime",
-  "Bridgestate",           "Direction",             "Newname",               "State",
-  "Bridgetype",            "Disposition",           "ObjectName",            "Status",
-  "CID-CallingPres",       "Domain",                "OldAccountCode",        "SubEvent",
-  "CallerID",              "Duration",              "OldMessages",           "Time",
-  "CallerID1",             "Dynamic",               "OldName",               "Timeout",
-  "CallerID2",             "Endtime",               "Outgoinglimit",         "TransferRate",
-  "CallerIDName",          "Event",                 "PagesTransferred",      "UniqueID",
-  "CallerIDNum",           "EventList",             "Paused",                "Uniqueid",
-  "Callgroup",             "Events",                "Peer",                  "Uniqueid1",
-  "CallsTaken",            "Exten",                 "PeerStatus",            "Uniqueid2",
-  "Cause",                 "Extension",             "Penalty",               "User",
-  "Cause-txt",             "Family",                "Pickupgroup",           "UserField",
-  "ChanObjectType",        "File",                  "Position",              "Username",
-  "Channel",               "FileName",              "Priority",              "Val",
-  "Channel1",              "Format",                "Privilege",             "Value",
-  "Channel2",              "From",                  "Queue",                 "Variable",
-  "ChannelState",          "Hint",                  "Reason",                "VoiceMailbox",
-  "ChannelStateDesc",      "Incominglimit",         "RegExpire",             "Waiting",
-  "ChannelType",           "Key",                   "RegExpiry",
+  STR("UNKNOWN"),            STR("CodecOrder"),         STR("LastApplication"),    STR("RemoteStationID"),
+  STR("ACL"),                STR("Codecs"),             STR("LastCall"),           STR("Resolution"),
+  STR("AMAflags"),           STR("Command"),            STR("LastData"),           STR("Response"),
+  STR("Account"),            STR("ConnectedLineName"),  STR("Link"),               STR("Restart"),
+  STR("AccountCode"),        STR("ConnectedLineNum"),   STR("ListItems"),          STR("SIPLastMsg"),
+  STR("Action"),             STR("Context"),            STR("LocalStationID"),     STR("SIP-AuthInsecure"),
+  STR("Address"),            STR("Count"),              STR("Location"),           STR("SIP-FromDomain"),
+  STR("Address-IP"),         STR("Data"),               STR("Loginchan"),          STR("SIP-FromUser"),
+  STR("Address-Port"),       STR("Default-Username"),   STR("Logintime"),          STR("SIP-NatSupport"),
+  STR("Agent"),              STR("Default-addr-IP"),    STR("MD5SecretExist"),     STR("Seconds"),
+  STR("AnswerTime"),         STR("DestUniqueID"),       STR("MOHSuggest"),         STR("Secret"),
+  STR("Append"),             STR("Destination"),        STR("Mailbox"),            STR("SecretExist"),
+  STR("Application"),        STR("DestinationChannel"), STR("Membership"),         STR("Shutdown"),
+  STR("Async"),              STR("DestinationContext"), STR("Message"),            STR("Source"),
+  STR("AuthType"),           STR("DialStatus"),         STR("Mix"),                STR("SrcUniqueID"),
+  STR("BillableSeconds"),    STR("Dialstring"),         STR("NewMessages"),        STR("StartTime"),
+  STR("Bridgestate"),        STR("Direction"),          STR("Newname"),            STR("State"),
+  STR("Bridgetype"),         STR("Disposition"),        STR("ObjectName"),         STR("Status"),
+  STR("CID-CallingPres"),    STR("Domain"),             STR("OldAccountCode"),     STR("SubEvent"),
+  STR("CallerID"),           STR("Duration"),           STR("OldMessages"),        STR("Time"),
+  STR("CallerID1"),          STR("Dynamic"),            STR("OldName"),            STR("Timeout"),
+  STR("CallerID2"),          STR("Endtime"),            STR("Outgoinglimit"),      STR("TransferRate"),
+  STR("CallerIDName"),       STR("Event"),              STR("PagesTransferred"),   STR("UniqueID"),
+  STR("CallerIDNum"),        STR("EventList"),          STR("Paused"),             STR("Uniqueid"),
+  STR("Callgroup"),          STR("Events"),             STR("Peer"),               STR("Uniqueid1"),
+  STR("CallsTaken"),         STR("Exten"),              STR("PeerStatus"),         STR("Uniqueid2"),
+  STR("Cause"),              STR("Extension"),          STR("Penalty"),            STR("User"),
+  STR("Cause-txt"),          STR("Family"),             STR("Pickupgroup"),        STR("UserField"),
+  STR("ChanObjectType"),     STR("File"),               STR("Position"),           STR("Username"),
+  STR("Channel"),            STR("FileName"),           STR("Priority"),           STR("Val"),
+  STR("Channel1"),           STR("Format"),             STR("Privilege"),          STR("Value"),
+  STR("Channel2"),           STR("From"),               STR("Queue"),              STR("Variable"),
+  STR("ChannelState"),       STR("Hint"),               STR("Reason"),             STR("VoiceMailbox"),
+  STR("ChannelStateDesc"),   STR("Incominglimit"),      STR("RegExpire"),          STR("Waiting"),
+  STR("ChannelType"),        STR("Key"),                STR("RegExpiry"),
   // added later
-  "ActionID",              "ExtraChannel",          "ExtraContext",          "ExtraPriority",
-  "Output",
+  STR("ActionID"),           STR("ExtraChannel"),       STR("ExtraContext"),       STR("ExtraPriority"),
+  STR("Output"),
 }; //}}}
 
+/*! Maximum number of registered headers: types must fit headers set. */
+#define CUSTOM_HDR_MAX (AMIHDR_SET_BITS - HDR_CUSTOM)
+
+/*! Registered headers hash table size. Power of two, keeps load under 1/2. */
+#define CUSTOM_HDR_INDEX_SIZE 256
+
+/*! Names of registered headers. */
+static struct str custom_hdr_str[CUSTOM_HDR_MAX];
+
+/*! Number of registered headers. */
+static int custom_hdr_count = 0;
+
+/*! Registered headers hash table: header index + 1 or 0 if empty. */
+static unsigned char custom_hdr_index[CUSTOM_HDR_INDEX_SIZE];
+
+/**
+ * Case insensitive FNV-1a hash of header name.
+ * @param name      Header name
+ * @param len       Header name length
+ * @return hash value.
+ */
+static unsigned int name_hash (const char *name, size_t len)
+{
+  unsigned int h = 2166136261u;
+
+  for (size_t i = 0; i < len; i++) {
+    h ^= (unsigned char) ascii_lower (name[i]);
+    h *= 16777619u;
+  }
+  return h;
+}
+
 static const char *event_type_name[]  = {
 //{{{
   "EVENT_UNKNOWN",        "ChannelTalkingStop",    "InvalidAccountID",      "PresenceStatus",
@@ -166,17 +291,184 @@ static const char *action_type_name[] = {
   "DBGet",                       "Park",                        "SCCPShowChannels",            "WaitEvent",
 }; //}}}
 
-struct str *str_set(const char *buf)
+/*! Number of names in names table. */
+#define NAMES_COUNT(names) ((int)(sizeof(names) / sizeof(char *)))
+
+/*! Names index states. */
+enum name_index_state {
+  NAME_INDEX_NONE,      /*!< Index is not built. */
+  NAME_INDEX_BUILDING,  /*!< Index is built by other thread. */
+  NAME_INDEX_READY,     /*!< Index is ready for search. */
+};
+
+/*!
+ * Names table index for binary search. Built on first search from
+ * names table, so table can be changed without updating the index.
+ */
+struct name_index {
+  const char    **names;  /*!< Names table indexed by type, type 0 is unknown. */
+  int           n;        /*!< Number of names in table. */
+  unsigned char *sorted;  /*!< Types ordered by name (case insensitive). */
+  unsigned char *lens;    /*!< Names lengths indexed by type. */
+  int           state;    /*!< Index state. */
+};
+
+// types and names lengths are stored in bytes
+typedef char event_names_fit[NAMES_COUNT(event_type_name) <= 256 ? 1 : -1];
+typedef char action_names_fit[NAMES_COUNT(action_type_name) <= 256 ? 1 : -1];
+
+static unsigned char event_type_sorted[NAMES_COUNT(event_type_name) - 1];
+static unsigned char event_type_len[NAMES_COUNT(event_type_name)];
+static struct name_index event_index = {
+  event_type_name, NAMES_COUNT(event_type_name), event_type_sorted, event_type_len, NAME_INDEX_NONE
+};
+
+static unsigned char action_type_sorted[NAMES_COUNT(action_type_name) - 1];
+static unsigned char action_type_len[NAMES_COUNT(action_type_name)];
+static struct name_index action_index = {
+  action_type_name, NAMES_COUNT(action_type_name), action_type_sorted, action_type_len, NAME_INDEX_NONE
+};
+
+/**
+ * Case insensitive names comparison.
+ * @param a         First name
+ * @param a_len     First name length
+ * @param b         Second name
+ * @param b_len     Second name length
+ * @return negative, zero or positive value like strcmp.
+ */
+static int name_cmp (const char *a, size_t a_len, const char *b, size_t b_len)
+{
+  int cmp = strncasecmp (a, b, a_len < b_len ? a_len : b_len);
+
+  return cmp ? cmp : (a_len > b_len) - (a_len < b_len);
+}
+
+/**
+ * Build names index: names lengths and types ordered by name.
+ * Index is built once, concurrent callers wait until it is ready.
+ * @param idx       Names index
+ */
+static void name_index_build (struct name_index *idx)
+{
+  int state = __atomic_load_n (&idx->state, __ATOMIC_ACQUIRE);
+
+  if (state == NAME_INDEX_READY)
+    return;
+
+  if (state == NAME_INDEX_NONE &&
+      __atomic_compare_exchange_n (&idx->state, &state, NAME_INDEX_BUILDING, 0,
+                                   __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+    for (int i = 0; i < idx->n; i++)
+      idx->lens[i] = strlen (idx->names[i]);
+
+    // insertion sort of types, done once for small tables
+    for (int i = 1; i < idx->n; i++) {
+      int j = i - 1;
+      while (j > 0 && name_cmp (idx->names[i], idx->lens[i],
+                                idx->names[idx->sorted[j - 1]],
+                                idx->lens[idx->sorted[j - 1]]) < 0) {
+        idx->sorted[j] = idx->sorted[j - 1];
+        j--;
+      }
+      idx->sorted[j] = i;
+    }
+
+    __atomic_store_n (&idx->state, NAME_INDEX_READY, __ATOMIC_RELEASE);
+    return;
+  }
+
+  while (__atomic_load_n (&idx->state, __ATOMIC_ACQUIRE) != NAME_INDEX_READY)
+    ;
+}
+
+/**
+ * Binary search of name in names index.
+ * @param idx       Names index
+ * @param name      Name to search (not required to be '\0' terminated)
+ * @param len       Name length
+ * @return type of name in names table or 0 if not found.
+ */
+static int name_search (struct name_index *idx, const char *name, size_t len)
+{
+  int lo = 0, hi = idx->n - 2;
+
+  name_index_build (idx);
+
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    int type = idx->sorted[mid];
+    int cmp = name_cmp (name, len, idx->names[type], idx->lens[type]);
+
+    if (cmp == 0)
+      return type;
+    if (cmp < 0)
+      hi = mid - 1;
+    else
+      lo = mid + 1;
+  }
+
+  return 0;
+}
+
+/**
+ * Set packet event or action type when Event or Action header is added.
+ * @param pack      AMI packet structure pointer
+ * @param hdr_type  AMI header type
+ * @param value     AMI header value
+ * @param len       AMI header value length
+ */
+static void amipack_classify (AMIPacket *pack, enum header_type hdr_type,
+                              const char *value, size_t len)
+{
+  if (hdr_type == Event)
+    pack->event = event_type_id (value, len);
+  else if (hdr_type == Action)
+    pack->action = action_type_id (value, len);
+}
+
+void amialloc_set (const AMIAllocator *alloc)
+{
+  if (alloc == NULL) {
+    allocator.alloc = libc_alloc;
+    allocator.realloc = libc_realloc;
+    allocator.free = libc_free;
+    allocator.ud = NULL;
+  } else {
+    allocator = *alloc;
+  }
+}
+
+void *amialloc (size_t size)
+{
+  return allocator.alloc (size, allocator.ud);
+}
+
+void *amirealloc (void *ptr, size_t size)
+{
+  return allocator.realloc (ptr, size, allocator.ud);
+}
+
+void amifree (void *ptr)
+{
+  if (ptr)
+    allocator.free (ptr, allocator.ud);
+}
+
+static struct str *str_set_n (const char *buf, size_t len)
 {
   struct str *res;
-  int len = buf == NULL ? 0 : (int)strlen (buf);
 
-  res = (struct str*) malloc (sizeof(struct str));
-  assert (res != NULL);
+  res = (struct str*) amialloc (sizeof(struct str));
+  if (res == NULL)
+    return NULL;
 
   res->len = len;
-  res->buf = (char *) malloc(len + 1); // +1 for \0
-  assert(res->buf != NULL);
+  res->buf = (char *) amialloc(len + 1); // +1 for \0
+  if (res->buf == NULL) {
+    amifree (res);
+    return NULL;
+  }
 
   for (int i = 0; i < len; i++) {
     res->buf[i] = buf[i];
@@ -187,111 +479,702 @@ struct str *str_set(const char *buf)
   return res;
 }
 
+struct str *str_set(const char *buf)
+{
+  return str_set_n (buf, buf == NULL ? 0 : strlen (buf));
+}
+
 void str_destroy (struct str *s)
 {
 
   if (s->buf) {
-    free(s->buf);
+    amifree(s->buf);
     s->buf = NULL;
   }
 
   if (s) {
-    free(s);
+    amifree(s);
     s = NULL;
   }
 
 }
 
-AMIHeader *amiheader_create ( enum header_type type,
-                              const char *name,
-                              const char *value)
+/**
+ * Initiate header with given strings. Strings are not copied.
+ * @param header    AMI header pointer
+ * @param type      AMI header type
+ * @param name      AMI header name
+ * @param name_len  AMI header name length
+ * @param value     AMI header value
+ * @param value_len AMI header value length
+ * @param flags     AMI header flags
+ */
+static void amiheader_init (AMIHeader *header, enum header_type type,
+                            const char *name, size_t name_len,
+                            const char *value, size_t value_len,
+                            unsigned int flags)
 {
-  int len = 0;
-  AMIHeader *header = (AMIHeader *) malloc (sizeof (AMIHeader));
-  assert ( header != NULL );
+  header->type        = type;
+  header->name_s.buf  = (char *) name;
+  header->name_s.len  = name_len;
+  header->value_s.buf = (char *) value;
+  header->value_s.len = value_len;
+  header->name        = known_hdr_name (type, name) ? hdr_type_str (type) : &header->name_s;
+  header->value       = &header->value_s;
+  header->next        = NULL;
+  header->flags       = flags;
+}
 
-  header->type = type;
+/**
+ * Copy header string. Short string is copied to header inline
+ * buffer, long string to packet memory or to heap if packet is NULL.
+ * @param header    AMI header pointer
+ * @param pack      AMI packet to allocate long string or NULL
+ * @param s         Header string to set
+ * @param buf       String to copy
+ * @param len       String length
+ * @param used      Used bytes of inline buffer
+ * @param heap_flag Header flag to set when string is copied to heap
+ * @return -1 if error or RV_SUCCESS
+ */
+static int amiheader_copy (AMIHeader *header, AMIPacket *pack, struct str *s,
+                           const char *buf, size_t len, size_t *used,
+                           unsigned int heap_flag)
+{
+  char *dst;
 
-  // add header name
-  header->name = str_set (name);
+  if (len < AMIHDR_INLINE_SIZE - *used) {
+    dst = header->inl + *used;
+    *used += len + 1;
+  } else if (pack) {
+    dst = amipack_alloc (pack, len + 1);
+  } else {
+    dst = (char *) amialloc (len + 1);
+    if (dst != NULL)
+      header->flags |= heap_flag;
+  }
 
-  // add header value
-  header->value = str_set (value);
+  if (dst == NULL)
+    return -1;
+
+  if (len)
+    memcpy (dst, buf, len);
+  dst[len] = '\0';
+
+  s->buf = dst;
+  s->len = len;
+
+  return RV_SUCCESS;
+}
+
+/**
+ * Create header in heap. Header released by packet is reused if any.
+ * @param pack      AMI packet to take released header from or NULL
+ * @param type      AMI header type
+ * @param name      AMI header name
+ * @param name_len  AMI header name length
+ * @param value     AMI header value
+ * @param value_len AMI header value length
+ * @return AMI header pointer or NULL if memory allocation failed.
+ */
+static AMIHeader *amiheader_create_n (AMIPacket *pack, enum header_type type,
+                                      const char *name, size_t name_len,
+                                      const char *value, size_t value_len)
+{
+  size_t used = 0;
+  AMIHeader *header;
+
+  if (pack && pack->free_hdrs) {
+    header = pack->free_hdrs;
+    pack->free_hdrs = header->next;
+  } else {
+    header = (AMIHeader *) amialloc (sizeof (AMIHeader));
+    if (header == NULL)
+      return NULL;
+  }
+
+  amiheader_init (header, type, name, name_len, NULL, 0, 0);
+  if (amiheader_copy (header, NULL, &header->value_s, value, value_len,
+                      &used, AMIHDR_VALUE_HEAP) != RV_SUCCESS ||
+      (!known_hdr_name (type, name) &&
+       amiheader_copy (header, NULL, &header->name_s, name, name_len,
+                       &used, AMIHDR_NAME_HEAP) != RV_SUCCESS)) {
+    amiheader_destroy (header);
+    return NULL;
+  }
 
   return header;
 }
 
+AMIHeader *amiheader_create ( enum header_type type,
+                              const char *name,
+                              const char *value)
+{
+  return amiheader_create_n (NULL, type, name, name ? strlen (name) : 0,
+                             value, value ? strlen (value) : 0);
+}
+
 void amiheader_destroy (AMIHeader *hdr)
 {
-  if (hdr) {
-    str_destroy (hdr->name);
-    str_destroy (hdr->value);
-    free(hdr);
+  // header in packet memory is freed with packet
+  if (hdr && !(hdr->flags & AMIHDR_PACKMEM)) {
+    if (hdr->flags & AMIHDR_NAME_HEAP)
+      amifree (hdr->name_s.buf);
+    if (hdr->flags & AMIHDR_VALUE_HEAP)
+      amifree (hdr->value_s.buf);
+    amifree(hdr);
   }
   hdr = NULL;
 }
 
 AMIPacket *amipack_init()
 {
-  AMIPacket *pack = (AMIPacket*) malloc(sizeof(AMIPacket));
+  return amipack_init_mode (AMIPACK_HEAP);
+}
+
+AMIPacket *amipack_init_mode(enum pack_mode mode)
+{
+  AMIPacket *pack;
+
+  if (mode == AMIPACK_ARENA) {
+    // packet, its slots and first memory block are one allocation
+    pack = (AMIPacket*) amialloc (mem_align (sizeof (AMIPacket)) +
+                                  INLINE_SLOTS_SIZE +
+                                  mem_align (sizeof (struct mem_block)) +
+                                  MEM_BLOCK_SIZE);
+    if (pack == NULL)
+      return NULL;
+    pack->mem = pack_first_block (pack);
+    pack->mem->next = NULL;
+    pack->mem->size = MEM_BLOCK_SIZE;
+    pack->mem->used = 0;
+  } else if (mode != AMIPACK_HEAP) {
+    // packet and its slots are one allocation
+    pack = (AMIPacket*) amialloc (mem_align (sizeof (AMIPacket)) +
+                                  INLINE_SLOTS_SIZE);
+    if (pack == NULL)
+      return NULL;
+    pack->mem = NULL;
+  } else {
+    pack = (AMIPacket*) amialloc(sizeof(AMIPacket));
+    if (pack == NULL)
+      return NULL;
+    pack->mem = NULL;
+  }
+
+  pack->spare = NULL;
+  pack->free_hdrs = NULL;
+
   pack->size = 0;
   pack->length = 0;
   pack->type = AMI_UNKNOWN;
+  pack->event = EVENT_UNKNOWN;
+  pack->action = ACTION_UNKNOWN;
   pack->head = NULL;
   pack->tail = NULL;
+  pack->mode = mode;
+  if (mode != AMIPACK_HEAP) {
+    pack->slots = pack_inline_slots (pack);
+    pack->types = (unsigned char *) (pack->slots + SLOTS_SIZE);
+    pack->slots_size = SLOTS_SIZE;
+  } else {
+    pack->types = NULL;
+    pack->slots = NULL;
+    pack->slots_size = 0;
+  }
+  amihdrset_clear (&pack->present);
+  pack->names = NULL;
+  pack->names_size = 0;
+  pack->names_len = 0;
+  pack->refs = 1;
 
   return pack;
 }
 
-void amipack_destroy (AMIPacket *pack)
+/**
+ * Allocate chunk of packet memory. New block is added
+ * when current block has no space for requested size.
+ * @param pack    AMI packet structure pointer
+ * @param size    Chunk size
+ * @return pointer to chunk or NULL if memory allocation failed.
+ */
+static void *amipack_alloc (AMIPacket *pack, size_t size)
+{
+  struct mem_block *blk = pack->mem;
+  size_t hdr_size = mem_align (sizeof (struct mem_block));
+  void *chunk;
+
+  size = mem_align (size);
+
+  if (blk == NULL || blk->size - blk->used < size) {
+    size_t blk_size = size > MEM_BLOCK_SIZE ? size : MEM_BLOCK_SIZE;
+    if (pack->spare && pack->spare->size >= blk_size) {
+      blk = pack->spare;
+      pack->spare = blk->next;
+    } else {
+      blk = (struct mem_block *) amialloc (hdr_size + blk_size);
+      if (blk == NULL)
+        return NULL;
+      blk->size = blk_size;
+    }
+    blk->used = 0;
+    blk->next = pack->mem;
+    pack->mem = blk;
+  }
+
+  chunk = (char *)blk + hdr_size + blk->used;
+  blk->used += size;
+
+  return chunk;
+}
+
+/**
+ * Create header in packet memory. Name and value are not copied.
+ * @param pack      AMI packet structure pointer
+ * @param hdr_type  AMI header type
+ * @param name      AMI header name
+ * @param name_len  AMI header name length
+ * @param value     AMI header value
+ * @param value_len AMI header value length
+ * @return AMI header pointer or NULL if memory allocation failed.
+ */
+static AMIHeader *amiheader_view (AMIPacket *pack, enum header_type hdr_type,
+                                  const char *name, size_t name_len,
+                                  const char *value, size_t value_len)
+{
+  AMIHeader *header = amipack_alloc (pack, sizeof (AMIHeader));
+
+  if (header == NULL)
+    return NULL;
+
+  amiheader_init (header, hdr_type, name, name_len, value, value_len, AMIHDR_PACKMEM);
+
+  return header;
+}
+
+/**
+ * Create header in packet memory with copies of name and value.
+ * Short strings are copied to header inline buffer, long strings to
+ * packet memory. Known header names are not copied.
+ * @param pack      AMI packet structure pointer
+ * @param hdr_type  AMI header type
+ * @param name      AMI header name
+ * @param name_len  AMI header name length
+ * @param value     AMI header value
+ * @param value_len AMI header value length
+ * @return AMI header pointer or NULL if memory allocation failed.
+ */
+static AMIHeader *amiheader_arena (AMIPacket *pack, enum header_type hdr_type,
+                                   const char *name, size_t name_len,
+                                   const char *value, size_t value_len)
+{
+  size_t used = 0;
+  AMIHeader *header = amiheader_view (pack, hdr_type, name, name_len, NULL, 0);
+
+  // chunks of failed header stay in packet memory until reset
+  if (header == NULL ||
+      amiheader_copy (header, pack, &header->value_s, value, value_len, &used, 0) != RV_SUCCESS ||
+      (!known_hdr_name (hdr_type, name) &&
+       amiheader_copy (header, pack, &header->name_s, name, name_len, &used, 0) != RV_SUCCESS))
+    return NULL;
+
+  return header;
+}
+
+/**
+ * Add header slot to the end of packet slots and types arrays.
+ * Arrays share one allocation and grow twice when full. Initial
+ * arrays allocated together with packet are not freed.
+ * Packet size is not changed.
+ * @param pack      AMI packet structure pointer
+ * @param hdr_type  AMI header type
+ * @param hdr       AMI header or NULL for AMIPACK_LAZY packet
+ * @param name      AMI header name
+ * @param name_len  AMI header name length
+ * @param value     AMI header value
+ * @param value_len AMI header value length
+ * @return -1 if error or RV_SUCCESS
+ */
+static int amipack_slot_add (AMIPacket *pack, enum header_type hdr_type,
+                             AMIHeader *hdr,
+                             const char *name, size_t name_len,
+                             const char *value, size_t value_len)
+{
+  struct hdr_slot *slot;
+
+  if (pack->size == pack->slots_size) {
+    int size = pack->slots_size ? pack->slots_size * 2 : SLOTS_SIZE;
+    struct hdr_slot *slots = (struct hdr_slot *) amialloc (size * (sizeof (struct hdr_slot) + 1));
+    if (slots == NULL)
+      return -1;
+    if (pack->size) {
+      memcpy (slots, pack->slots, pack->size * sizeof (struct hdr_slot));
+      memcpy (slots + size, pack->types, pack->size);
+    }
+    if (!pack_slots_inline (pack))
+      amifree (pack->slots);
+    pack->slots = slots;
+    pack->types = (unsigned char *) (slots + size);
+    pack->slots_size = size;
+  }
+
+  slot = &pack->slots[pack->size];
+  slot->hdr       = hdr;
+  slot->name      = name;
+  slot->name_len  = name_len;
+  slot->value     = value;
+  slot->value_len = value_len;
+  slot->next      = 0;
+
+  hdr_type = slot_type (hdr_type);
+  pack->types[pack->size] = hdr_type;
+
+  // index first header of every type and link headers of the same type
+  if (pack->size <= SLOT_FIRST_MAX) {
+    if (!amihdrset_has (&pack->present, hdr_type)) {
+      amihdrset_add (&pack->present, hdr_type);
+      pack->first[hdr_type] = pack->size;
+    } else {
+      pack->slots[pack->last[hdr_type]].next = pack->size;
+    }
+    pack->last[hdr_type] = pack->size;
+  }
+
+  return RV_SUCCESS;
+}
+
+/**
+ * Record header of AMIPACK_LAZY packet.
+ * @param pack      AMI packet structure pointer
+ * @param hdr_type  AMI header type
+ * @param name      AMI header name
+ * @param name_len  AMI header name length
+ * @param value     AMI header value
+ * @param value_len AMI header value length
+ * @return -1 if error or RV_SUCCESS
+ */
+static int amipack_record (AMIPacket *pack, enum header_type hdr_type,
+                           const char *name, size_t name_len,
+                           const char *value, size_t value_len)
+{
+  if (amipack_slot_add (pack, hdr_type, NULL, name, name_len,
+                        value, value_len) != RV_SUCCESS)
+    return -1;
+
+  pack->length += name_len + value_len + 4; // ": " = 2 char and CRLF = 2 char
+  pack->size++;
+
+  return RV_SUCCESS;
+}
+
+/**
+ * Get header from packet slot. Header of AMIPACK_LAZY
+ * packet is created on first request.
+ * @param pack      AMI packet structure pointer
+ * @param i         Slot index
+ * @return AMI header pointer or NULL if memory allocation failed.
+ */
+static AMIHeader *slot_header (AMIPacket *pack, int i)
 {
+  struct hdr_slot *slot = &pack->slots[i];
+
+  if (slot->hdr == NULL)
+    slot->hdr = amiheader_view (pack, pack->types[i], slot->name, slot->name_len,
+                                slot->value, slot->value_len);
+  return slot->hdr;
+}
+
+int amipack_decode (AMIPacket *pack)
+{
+  AMIHeader *hdr;
+
+  if (pack->mode != AMIPACK_LAZY)
+    return RV_SUCCESS;
+
+  for (int i = 0; i < pack->size; i++) {
+    hdr = slot_header (pack, i);
+    if (hdr == NULL) {
+      // created headers are reused on next decode
+      pack->head = NULL;
+      pack->tail = NULL;
+      return -1;
+    }
+    if (pack->tail)
+      pack->tail->next = hdr;
+    else
+      pack->head = hdr;
+    pack->tail = hdr;
+  }
+
+  pack->mode = AMIPACK_VIEW;
+  return RV_SUCCESS;
+}
 
+/**
+ * Remove all headers from AMI packet keeping memory blocks.
+ * @param pack      AMI packet structure pointer
+ */
+static void amipack_clear (AMIPacket *pack)
+{
   AMIHeader *hdr, *hnext;
+  struct mem_block *first = NULL;
 
+  // heap headers are kept for next appends, their long strings are freed
   for ( hdr = pack->head; hdr != NULL; hdr = hnext) {
-
     hnext = hdr->next;
-    amiheader_destroy (hdr);
+    if (hdr->flags & AMIHDR_PACKMEM)
+      continue;
+    if (hdr->flags & AMIHDR_NAME_HEAP)
+      amifree (hdr->name_s.buf);
+    if (hdr->flags & AMIHDR_VALUE_HEAP)
+      amifree (hdr->value_s.buf);
+    hdr->next = pack->free_hdrs;
+    pack->free_hdrs = hdr;
+  }
+
+  // first block of arena packet stays in use, other blocks are spare
+  for (struct mem_block *blk = pack->mem, *bnext; blk; blk = bnext) {
+    bnext = blk->next;
+    blk->used = 0;
+    if (pack->mode == AMIPACK_ARENA && blk == pack_first_block (pack)) {
+      first = blk;
+      first->next = NULL;
+    } else {
+      blk->next = pack->spare;
+      pack->spare = blk;
+    }
+  }
+
+  pack->mem = first;
+  pack->size = 0;
+  pack->length = 0;
+  pack->type = AMI_UNKNOWN;
+  pack->event = EVENT_UNKNOWN;
+  pack->action = ACTION_UNKNOWN;
+  pack->head = NULL;
+  pack->tail = NULL;
+  amihdrset_clear (&pack->present);
+  pack->names_len = 0;
+}
+
+void amipack_reset (AMIPacket *pack)
+{
+  if (!amipack_shared (pack))
+    amipack_clear (pack);
+}
+
+void amipack_destroy (AMIPacket *pack)
+{
 
+  amipack_clear (pack);
+
+  for (struct mem_block *blk = pack->spare, *bnext; blk; blk = bnext) {
+    bnext = blk->next;
+    amifree (blk);
+  }
+
+  for (AMIHeader *hdr = pack->free_hdrs, *hnext; hdr; hdr = hnext) {
+    hnext = hdr->next;
+    amifree (hdr);
   }
 
+  if (!pack_slots_inline (pack))
+    amifree (pack->slots);
+  amifree (pack->names);
+
   if (pack != NULL) {
 
-    free(pack);
+    amifree(pack);
     pack = NULL;
 
   }
 
 }
 
+AMIPackPool *amipool_init (enum pack_mode mode, int size)
+{
+  AMIPackPool *pool = (AMIPackPool *) amialloc (sizeof (AMIPackPool));
+  if (pool == NULL)
+    return NULL;
+
+  pool->packs = (AMIPacket **) amialloc (size * sizeof (AMIPacket *));
+  if (pool->packs == NULL) {
+    amifree (pool);
+    return NULL;
+  }
+  pool->len = 0;
+  pool->size = size;
+  pool->mode = mode;
+
+  return pool;
+}
+
+void amipool_destroy (AMIPackPool *pool)
+{
+  if (pool) {
+    for (int i = 0; i < pool->len; i++)
+      amipack_destroy (pool->packs[i]);
+    amifree (pool->packs);
+    amifree (pool);
+  }
+}
+
+AMIPacket *amipool_get (AMIPackPool *pool)
+{
+  AMIPacket *pack;
+
+  if (pool->len == 0)
+    return amipack_init_mode (pool->mode);
+
+  pack = pool->packs[--pool->len];
+  // decoded lazy packet is switched to view mode
+  pack->mode = pool->mode;
+  return pack;
+}
+
+void amipool_put (AMIPackPool *pool, AMIPacket *pack)
+{
+  // shared packet is freed by last reference
+  if (amipack_shared (pack)) {
+    amipack_unref (pack);
+    return;
+  }
+
+  // packet of other memory layout is not kept, only decoded lazy
+  // packet of lazy pool is in other mode
+  if (pool->len == pool->size ||
+      (pack->mode != pool->mode &&
+       !(pool->mode == AMIPACK_LAZY && pack->mode == AMIPACK_VIEW))) {
+    amipack_destroy (pack);
+    return;
+  }
+
+  amipack_reset (pack);
+  pool->packs[pool->len++] = pack;
+}
+
+/**
+ * Append created header to packet. Header is destroyed
+ * if it can not be appended.
+ * @param pack      AMI packet structure pointer
+ * @param header    AMI header
+ * @return -1 if error or RV_SUCCESS
+ */
+static int pack_append_header (AMIPacket *pack, AMIHeader *header)
+{
+  if (amipack_list_append (pack, header) != RV_SUCCESS) {
+    amiheader_destroy (header);
+    return -1;
+  }
+  return RV_SUCCESS;
+}
+
 int amipack_append( AMIPacket *pack,
                     enum header_type hdr_type,
                     const char *hdr_value)
 {
   AMIHeader *header;
 
-  if ( !valid_hdr_type(hdr_type) )
+  // shared packet is immutable
+  if ( !valid_hdr_type(hdr_type) || amipack_shared (pack) )
+    return -1;
+
+  if (pack->mode == AMIPACK_ARENA)
+    return amipack_append_n (pack, hdr_type, NULL, 0,
+                             hdr_value, hdr_value ? strlen (hdr_value) : 0);
+
+  header = amiheader_create_n (pack, hdr_type,
+                               hdr_type_str (hdr_type)->buf,
+                               hdr_type_str (hdr_type)->len,
+                               hdr_value, hdr_value ? strlen (hdr_value) : 0);
+  if (header == NULL)
     return -1;
 
-  header = amiheader_create (hdr_type,
-                             (const char *)header_type_name[hdr_type],
-                             hdr_value);
+  amipack_classify (pack, hdr_type, header->value->buf, header->value->len);
 
-  return amipack_list_append (pack, header);
+  return pack_append_header (pack, header);
 }
 
 int amipack_append_unknown (AMIPacket *pack,
                             const char *name,
                             const char *value)
 {
-  AMIHeader *header = amiheader_create (HDR_UNKNOWN, name, value);
+  AMIHeader *header;
+  enum header_type hdr_type = name ? header_type_id (name, strlen (name)) : HDR_UNKNOWN;
+
+  if (amipack_shared (pack))
+    return -1;
+
+  if (hdr_type != HDR_UNKNOWN)
+    return amipack_append (pack, hdr_type, value);
+
+  if (pack->mode == AMIPACK_ARENA)
+    return amipack_append_n (pack, HDR_UNKNOWN, name ? name : "", name ? strlen (name) : 0,
+                             value, value ? strlen (value) : 0);
+
+  header = amiheader_create_n (pack, HDR_UNKNOWN, name, name ? strlen (name) : 0,
+                               value, value ? strlen (value) : 0);
+  if (header == NULL)
+    return -1;
+
+  return pack_append_header (pack, header);
+}
+
+int amipack_append_n (AMIPacket *pack,
+                      enum header_type hdr_type,
+                      const char *name, size_t name_len,
+                      const char *value, size_t value_len)
+{
+  AMIHeader *header;
+
+  if (amipack_shared (pack))
+    return -1;
+
+  if (hdr_type != HDR_UNKNOWN) {
+    if ( !valid_hdr_type(hdr_type) )
+      return -1;
+    name = hdr_type_str (hdr_type)->buf;
+    name_len = hdr_type_str (hdr_type)->len;
+  }
+
+  if (value == NULL) {
+    value = "";
+    value_len = 0;
+  }
+
+  amipack_classify (pack, hdr_type, value, value_len);
 
-  return amipack_list_append (pack, header);
+  if (pack->mode == AMIPACK_LAZY) {
+    return amipack_record (pack, hdr_type, name, name_len, value, value_len);
+  } else if (pack->mode == AMIPACK_VIEW) {
+    header = amiheader_view (pack, hdr_type, name, name_len, value, value_len);
+  } else if (pack->mode == AMIPACK_ARENA) {
+    header = amiheader_arena (pack, hdr_type, name, name_len, value, value_len);
+  } else {
+    header = amiheader_create_n (pack, hdr_type, name, name_len, value, value_len);
+  }
+
+  if (header == NULL)
+    return -1;
+
+  return pack_append_header (pack, header);
 }
 
 int amipack_list_append (AMIPacket *pack,
                          AMIHeader *header)
 {
+  if (amipack_shared (pack))
+    return -1;
+
+  // keep headers order of lazy packet
+  if (amipack_decode (pack) != RV_SUCCESS)
+    return -1;
+
+  if (amipack_slot_add (pack, header->type, header,
+                        header->name->buf, header->name->len,
+                        header->value->buf, header->value->len) != RV_SUCCESS)
+    return -1;
+
   pack->length += header->name->len + header->value->len + 4; // ": " = 2 char and CRLF = 2 char
 
   // first header becomes head and tail
@@ -329,55 +1212,432 @@ int amiheader_to_str( AMIHeader *hdr,
   return len;
 }
 
+size_t amipack_write (AMIPacket *pack, char *dst, size_t cap)
+{
+  size_t size = amipack_length (pack);
+
+  if (pack->size == 0)
+    return 0;
+
+  if (cap < size)
+    return size;
+
+  // slots keep headers strings in all modes, lazy packet is not decoded
+  for (int i = 0; i < pack->size; i++) {
+    struct hdr_slot *slot = &pack->slots[i];
+    memcpy (dst, slot->name, slot->name_len);
+    dst += slot->name_len;
+    *dst++ = ':';
+    *dst++ = ' ';
+    memcpy (dst, slot->value, slot->value_len);
+    dst += slot->value_len;
+    *dst++ = '\r';
+    *dst++ = '\n';
+  }
+
+  *dst++ = '\r';
+  *dst++ = '\n';
+
+  return size;
+}
+
+int amipack_iovec (AMIPacket *pack, struct iovec *iov, int max)
+{
+  static const char sep[] = ": ", crlf[] = "\r\n";
+  int len = amipack_iovec_len (pack);
+
+  if (pack->size == 0)
+    return 0;
+
+  if (max < len)
+    return len;
+
+  for (int i = 0; i < pack->size; i++, iov += 4) {
+    struct hdr_slot *slot = &pack->slots[i];
+    iov[0].iov_base = (void *) slot->name;
+    iov[0].iov_len  = slot->name_len;
+    iov[1].iov_base = (void *) sep;
+    iov[1].iov_len  = 2;
+    iov[2].iov_base = (void *) slot->value;
+    iov[2].iov_len  = slot->value_len;
+    iov[3].iov_base = (void *) crlf;
+    iov[3].iov_len  = 2;
+  }
+  iov->iov_base = (void *) crlf;
+  iov->iov_len  = 2;
+
+  return len;
+}
+
+AMITemplate *amitmpl_create (AMIPacket *pack, const AMIHdrSet *vars)
+{
+  AMITemplate *tmpl;
+  size_t len = amipack_length (pack);
+  int size = 0;
+  char *p;
+
+  if (pack->size == 0)
+    return NULL;
+
+  for (int i = 0; i < pack->size; i++) {
+    if (amihdrset_has (vars, pack->types[i])) {
+      len -= pack->slots[i].value_len;
+      size++;
+    }
+  }
+
+  // template, offsets and text are one allocation
+  tmpl = (AMITemplate *) amialloc (sizeof (AMITemplate) + size * sizeof (size_t) + len);
+  if (tmpl == NULL)
+    return NULL;
+
+  tmpl->cuts = (size_t *) (tmpl + 1);
+  tmpl->buf = (char *) (tmpl->cuts + size);
+  tmpl->len = len;
+  tmpl->size = 0;
+
+  p = tmpl->buf;
+  for (int i = 0; i < pack->size; i++) {
+    struct hdr_slot *slot = &pack->slots[i];
+    memcpy (p, slot->name, slot->name_len);
+    p += slot->name_len;
+    *p++ = ':';
+    *p++ = ' ';
+    if (amihdrset_has (vars, pack->types[i])) {
+      tmpl->cuts[tmpl->size++] = p - tmpl->buf;
+    } else {
+      memcpy (p, slot->value, slot->value_len);
+      p += slot->value_len;
+    }
+    *p++ = '\r';
+    *p++ = '\n';
+  }
+  *p++ = '\r';
+  *p++ = '\n';
+
+  return tmpl;
+}
+
+void amitmpl_destroy (AMITemplate *tmpl)
+{
+  amifree (tmpl);
+}
+
+size_t amitmpl_write (const AMITemplate *tmpl, const char *const *values,
+                      char *dst, size_t cap)
+{
+  size_t size = tmpl->len, off = 0;
+
+  for (int i = 0; i < tmpl->size; i++)
+    size += values[i] ? strlen (values[i]) : 0;
+
+  if (cap < size)
+    return size;
+
+  for (int i = 0; i < tmpl->size; i++) {
+    size_t len = values[i] ? strlen (values[i]) : 0;
+    memcpy (dst, tmpl->buf + off, tmpl->cuts[i] - off);
+    dst += tmpl->cuts[i] - off;
+    off = tmpl->cuts[i];
+    if (len)
+      memcpy (dst, values[i], len);
+    dst += len;
+  }
+  memcpy (dst, tmpl->buf + off, tmpl->len - off);
+
+  return size;
+}
+
+/**
+ * Add bytes to built packet. Bytes that do not fit buffer are
+ * only counted.
+ * @param build     Builder structure pointer
+ * @param buf       Bytes to add
+ * @param len       Number of bytes
+ */
+static void build_put (AMIBuilder *build, const char *buf, size_t len)
+{
+  if (len && build->len + len <= build->cap)
+    memcpy (build->buf + build->len, buf, len);
+  build->len += len;
+}
+
+/**
+ * Add header to built packet.
+ * @param build     Builder structure pointer
+ * @param name      Header name
+ * @param name_len  Header name length
+ * @param value     Header value
+ * @param value_len Header value length
+ */
+static void build_header (AMIBuilder *build, const char *name, size_t name_len,
+                          const char *value, size_t value_len)
+{
+  build_put (build, name, name_len);
+  build_put (build, ": ", 2);
+  build_put (build, value, value_len);
+  build_put (build, "\r\n", 2);
+}
+
+/**
+ * Add header with unsigned integer value to built packet.
+ * @param build     Builder structure pointer
+ * @param type      Header type
+ * @param value     Absolute header value
+ * @param neg       Non zero if value is negative
+ * @return -1 if header type is invalid or RV_SUCCESS
+ */
+static int build_num (AMIBuilder *build, enum header_type type,
+                      unsigned long value, int neg)
+{
+  char num[24], *p = num + sizeof (num);
+
+  if ( !valid_hdr_type(type) )
+    return -1;
+
+  do {
+    *--p = '0' + value % 10;
+    value /= 10;
+  } while (value);
+
+  if (neg)
+    *--p = '-';
+
+  build_header (build, hdr_type_str (type)->buf, hdr_type_str (type)->len,
+                p, num + sizeof (num) - p);
+  return RV_SUCCESS;
+}
+
+void amibuild_begin (AMIBuilder *build, char *buf, size_t cap)
+{
+  build->buf = buf;
+  build->cap = cap;
+  build->len = 0;
+}
+
+int amibuild_header (AMIBuilder *build, enum header_type type, const char *value)
+{
+  if ( !valid_hdr_type(type) )
+    return -1;
+
+  build_header (build, hdr_type_str (type)->buf, hdr_type_str (type)->len,
+                value, value ? strlen (value) : 0);
+  return RV_SUCCESS;
+}
+
+void amibuild_unknown (AMIBuilder *build, const char *name, const char *value)
+{
+  build_header (build, name, name ? strlen (name) : 0,
+                value, value ? strlen (value) : 0);
+}
+
+int amibuild_int (AMIBuilder *build, enum header_type type, long value)
+{
+  // negate as unsigned to handle LONG_MIN
+  return value < 0 ? build_num (build, type, 0UL - (unsigned long) value, 1)
+                   : build_num (build, type, value, 0);
+}
+
+int amibuild_uint (AMIBuilder *build, enum header_type type, unsigned long value)
+{
+  return build_num (build, type, value, 0);
+}
+
+size_t amibuild_end (AMIBuilder *build)
+{
+  build_put (build, "\r\n", 2);
+  return build->len;
+}
+
 struct str *amipack_to_str( AMIPacket *pack)
 {
+  struct str *res;
+  size_t size = amipack_length (pack);
 
-  int len = 0, size = 0;
   if (pack->size == 0) {
     return NULL;
   }
-  char *str_pack = (char*) malloc (amipack_length (pack));
-  struct str *res = (struct str*) malloc (sizeof(struct str));
 
-  for (AMIHeader *hdr = pack->head; hdr; hdr = hdr->next) {
-    len = amiheader_to_str (hdr, str_pack);
-    str_pack += len;
-    size += len;
-  }
+  res = (struct str*) amialloc (sizeof(struct str));
+  if (res == NULL)
+    return NULL;
 
-  *str_pack++ = '\r';  size++;
-  *str_pack++ = '\n';  size++;
-  // rewind str_pack
-  str_pack = str_pack - size;
+  res->buf = (char*) amialloc (size);
+  if (res->buf == NULL) {
+    amifree (res);
+    return NULL;
+  }
 
-  res->len = size;
-  res->buf = str_pack;
+  res->len = amipack_write (pack, res->buf, size);
   return res;
 }
 
-struct str *amiheader_value(AMIPacket *pack, enum header_type type)
+/**
+ * Find slot of next header of given type.
+ * @param pack      AMI packet structure pointer
+ * @param type      Header type to search
+ * @param from      Slot of previous header of this type or -1 for first header
+ * @return slot of header or -1 if not found.
+ */
+static int type_slot_next (AMIPacket *pack, enum header_type type, int from)
 {
-  struct str *hv = NULL;
-  for (AMIHeader *hdr = pack->head; hdr; hdr = hdr->next) {
-    if (hdr->type == type) {
-      hv = hdr->value;
-      break;
+  const unsigned char *p;
+  int start;
+
+  // types out of dense array range are stored as HDR_UNKNOWN
+  if (slot_type (type) != type) {
+    for (int i = from + 1; i < pack->size; i++) {
+      if (pack->slots[i].hdr && pack->slots[i].hdr->type == type)
+        return i;
     }
+    return -1;
+  }
+
+  if (from < 0) {
+    if (amihdrset_has (&pack->present, type))
+      return pack->first[type];
+  } else if (pack->slots[from].next) {
+    return pack->slots[from].next;
+  }
+
+  // only first SLOT_FIRST_MAX headers are indexed
+  start = from < SLOT_FIRST_MAX ? SLOT_FIRST_MAX + 1 : from + 1;
+  if (start >= pack->size ||
+      (p = memchr (pack->types + start, type, pack->size - start)) == NULL)
+    return -1;
+
+  return p - pack->types;
+}
+
+struct str *amiheader_value(AMIPacket *pack, enum header_type type)
+{
+  int i = type_slot_next (pack, type, -1);
+  AMIHeader *hdr = i < 0 ? NULL : slot_header (pack, i);
+
+  return hdr ? hdr->value : NULL;
+}
+
+void amiheader_iter(AMIHdrIter *iter, AMIPacket *pack, enum header_type type)
+{
+  iter->pack = pack;
+  iter->type = type;
+  iter->slot = type_slot_next (pack, type, -1);
+}
+
+struct str *amiheader_iter_next(AMIHdrIter *iter)
+{
+  int i = iter->slot;
+  AMIHeader *hdr;
+
+  if (i < 0 || (hdr = slot_header (iter->pack, i)) == NULL)
+    return NULL;
+
+  iter->slot = type_slot_next (iter->pack, iter->type, i);
+  return hdr->value;
+}
+
+/**
+ * Find names index entry of header name: entry with slot of the
+ * first header with this name or empty entry.
+ * @param pack      AMI packet structure pointer
+ * @param name      Header name (not required to be '\0' terminated)
+ * @param len       Header name length
+ * @return names index entry pointer.
+ */
+static unsigned int *names_entry (AMIPacket *pack, const char *name, size_t len)
+{
+  unsigned int mask = pack->names_size - 1;
+  unsigned int i = name_hash (name, len) & mask;
+
+  // header names are not '\0' terminated in AMIPACK_VIEW packets
+  for (;; i = (i + 1) & mask) {
+    unsigned int *entry = &pack->names[i];
+    struct hdr_slot *slot;
+
+    if (*entry == 0)
+      return entry;
+    slot = &pack->slots[*entry - 1];
+    if (slot->name_len == len && strncasecmp (slot->name, name, len) == 0)
+      return entry;
+  }
+}
+
+/**
+ * Add packet headers to names index. Index is rebuilt when load
+ * factor exceeds 1/2, otherwise only headers added after last
+ * update are added.
+ * @param pack      AMI packet structure pointer
+ * @return -1 if error or RV_SUCCESS
+ */
+static int names_index_update (AMIPacket *pack)
+{
+  if (pack->size * 2 > pack->names_size) {
+    int size = pack->names_size ? pack->names_size : NAMES_INDEX_SIZE;
+    unsigned int *names;
+
+    while (size < pack->size * 2)
+      size *= 2;
+    names = (unsigned int *) amialloc (size * sizeof (unsigned int));
+    if (names == NULL)
+      return -1;
+    amifree (pack->names);
+    pack->names = names;
+    pack->names_size = size;
+    pack->names_len = 0;
+  }
+
+  if (pack->names_len == 0)
+    memset (pack->names, 0, pack->names_size * sizeof (unsigned int));
+
+  for (; pack->names_len < pack->size; pack->names_len++) {
+    struct hdr_slot *slot = &pack->slots[pack->names_len];
+    unsigned int *entry = names_entry (pack, slot->name, slot->name_len);
+    // keep first header with the name
+    if (*entry == 0)
+      *entry = pack->names_len + 1;
   }
-  return hv;
+
+  return RV_SUCCESS;
 }
 
 struct str *amiheader_value_by_hdr_name(AMIPacket *pack,
                                         const char *header_name)
 {
-  struct str *hv = NULL;
-  for (AMIHeader *hdr = pack->head; hdr; hdr = hdr->next) {
-    if (strcasecmp(hdr->name->buf, header_name ) == 0) {
-      hv = hdr->value;
-      break;
-    }
+  size_t len = strlen (header_name);
+  unsigned int *entry;
+  AMIHeader *hdr;
+
+  if (pack->size == 0)
+    return NULL;
+
+  if (pack->names_len < pack->size && names_index_update (pack) != RV_SUCCESS)
+    return NULL;
+
+  entry = names_entry (pack, header_name, len);
+  if (*entry == 0)
+    return NULL;
+
+  hdr = slot_header (pack, *entry - 1);
+  return hdr ? hdr->value : NULL;
+}
+
+AMIPacket *amipack_ref (AMIPacket *pack)
+{
+  // only owner holds the packet: prepare it for concurrent readers
+  if (!amipack_shared (pack)) {
+    if (amipack_decode (pack) != RV_SUCCESS ||
+        (pack->names_len < pack->size && names_index_update (pack) != RV_SUCCESS))
+      return NULL;
   }
-  return hv;
+
+  __atomic_add_fetch (&pack->refs, 1, __ATOMIC_RELAXED);
+  return pack;
+}
+
+void amipack_unref (AMIPacket *pack)
+{
+  if (pack && __atomic_sub_fetch (&pack->refs, 1, __ATOMIC_ACQ_REL) == 0)
+    amipack_destroy (pack);
 }
 
 int amiparse_stanza (const char *packet, int size)
@@ -405,8 +1665,9 @@ char *substr (  const char* s,
   }
   size = len - offset + 1;
 
-  char *res = (char*) malloc (size);
-  assert(res != NULL);
+  char *res = (char*) amialloc (size);
+  if (res == NULL)
+    return NULL;
   for (i = 0; offset < len; offset++, i++) {
     res[i] = s[offset];
   }
@@ -425,7 +1686,99 @@ const char *pack_type_str(enum pack_type type)
 
 const char *header_name(enum header_type type)
 {
-  if(!valid_hdr_type(type)) return header_type_name[HDR_UNKNOWN];
-  return header_type_name[type];
+  if(!valid_hdr_type(type)) return header_type_str[HDR_UNKNOWN].buf;
+  return hdr_type_str (type)->buf;
+}
+
+/**
+ * Find registry entry of header name: entry with registered
+ * header index + 1 or empty entry.
+ * @param name      Header name (not required to be '\0' terminated)
+ * @param len       Header name length
+ * @return registry entry pointer.
+ */
+static unsigned char *custom_hdr_entry (const char *name, size_t len)
+{
+  unsigned int i = name_hash (name, len) & (CUSTOM_HDR_INDEX_SIZE - 1);
+
+  for (;; i = (i + 1) & (CUSTOM_HDR_INDEX_SIZE - 1)) {
+    struct str *s;
+    if (custom_hdr_index[i] == 0)
+      return &custom_hdr_index[i];
+    s = &custom_hdr_str[custom_hdr_index[i] - 1];
+    if (s->len == len && strncasecmp (s->buf, name, len) == 0)
+      return &custom_hdr_index[i];
+  }
+}
+
+int amiheader_register(const char *name)
+{
+  size_t len = name ? strlen (name) : 0;
+  unsigned char *entry;
+  char *buf;
+
+  if (len == 0 || strpbrk (name, ": \r\n") != NULL)
+    return -1;
+
+  for (int i = 1; i < HDR_CUSTOM; i++) {
+    if (header_type_str[i].len == len && strcasecmp (header_type_str[i].buf, name) == 0)
+      return i;
+  }
+
+  entry = custom_hdr_entry (name, len);
+  if (*entry)
+    return HDR_CUSTOM + *entry - 1;
+
+  if (custom_hdr_count == CUSTOM_HDR_MAX || (buf = amialloc (len + 1)) == NULL)
+    return -1;
+  memcpy (buf, name, len + 1);
+
+  custom_hdr_str[custom_hdr_count].buf = buf;
+  custom_hdr_str[custom_hdr_count].len = len;
+  *entry = ++custom_hdr_count;
+
+  return HDR_CUSTOM + custom_hdr_count - 1;
+}
+
+void amiheader_unregister_all(void)
+{
+  for (int i = 0; i < custom_hdr_count; i++)
+    amifree (custom_hdr_str[i].buf);
+  custom_hdr_count = 0;
+  memset (custom_hdr_index, 0, sizeof (custom_hdr_index));
+}
+
+enum header_type header_type_id(const char *name, size_t len)
+{
+  unsigned char *entry;
+
+  if (custom_hdr_count == 0)
+    return HDR_UNKNOWN;
+
+  entry = custom_hdr_entry (name, len);
+  return *entry ? HDR_CUSTOM + *entry - 1 : HDR_UNKNOWN;
+}
+
+enum event_type event_type_id(const char *name, size_t len)
+{
+  return name_search (&event_index, name, len);
 }
 
+enum action_type action_type_id(const char *name, size_t len)
+{
+  return name_search (&action_index, name, len);
+}
+
+const char *event_name(enum event_type type)
+{
+  if (type <= 0 || type >= sizeof(event_type_name)/sizeof(char*))
+    return event_type_name[EVENT_UNKNOWN];
+  return event_type_name[type];
+}
+
+const char *action_name(enum action_type type)
+{
+  if (type <= 0 || type >= sizeof(action_type_name)/sizeof(char*))
+    return action_type_name[ACTION_UNKNOWN];
+  return action_type_name[type];
+}
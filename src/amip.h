@@ -22,7 +22,8 @@
  * @file amip.h
  * @brief AMI (Asterisk Management Interface) messages
  * read/create functions interface.
- * AMI packet is implemented as linked list of headers.
+ * AMI packet keeps its headers in slot and type arrays in packet
+ * order; linked list of headers is kept for compatibility.
  *
  * @author Stas Kobzar <stas.kobzar@modulis.ca>
  */
@@ -32,11 +33,14 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <sys/uio.h>
 
 /*! Value to return on success. */
 #define RV_SUCCESS 0
 /*! Value to return on fail. */
 #define RV_FAIL    !RV_SUCCESS
+/*! Value to return when memory allocation failed and operation can be retried. */
+#define RV_ENOMEM  (RV_FAIL + 1)
 
 /*!
  * Return length of the packet as string representation.
@@ -50,6 +54,16 @@
 /*! Number of headers in packet. */
 #define amipack_size(pack) (pack)->size
 
+/*! AMI event type of packet (enum event_type). */
+#define amipack_event(pack) (pack)->event
+
+/*! AMI action type of packet (enum action_type). */
+#define amipack_action(pack) (pack)->action
+
+/*! Check if packet has header of given type. */
+#define amipack_has_header(pack, hdr_type) \
+  ((hdr_type) >= 0 && (hdr_type) < AMIHDR_SET_BITS && amihdrset_has (&(pack)->present, hdr_type))
+
 /*!
  * String structure for libamip library.
  * Stores char array and its length.
@@ -64,6 +78,40 @@ enum pack_type {
   AMI_UNKNOWN, AMI_PROMPT, AMI_ACTION, AMI_EVENT, AMI_RESPONSE
 };
 
+/*! AMI packet memory modes. */
+enum pack_mode {
+  AMIPACK_HEAP, /*!< Headers and strings are allocated one by one (default). */
+  AMIPACK_VIEW, /*!< Headers are kept in packet memory, strings point to parsed buffer. */
+  AMIPACK_LAZY, /*!< Only headers types and strings positions are recorded,
+                     headers are created when requested (see amipack_decode). */
+  AMIPACK_ARENA, /*!< Headers and strings copies are kept in packet memory,
+                      allocated with packet and freed at once with packet. */
+};
+
+/*! Header flag: header is allocated in packet memory and is freed with packet. */
+#define AMIHDR_PACKMEM 0x01
+
+/*! Header flag: header name buffer is allocated in heap. */
+#define AMIHDR_NAME_HEAP 0x02
+
+/*! Header flag: header value buffer is allocated in heap. */
+#define AMIHDR_VALUE_HEAP 0x04
+
+/*! Size of header inline buffer for short name and value copies. */
+#define AMIHDR_INLINE_SIZE 32
+
+/*! Maximum number of header types in headers set. */
+#define AMIHDR_SET_BITS 256
+
+/*! Remove all header types from headers set. */
+#define amihdrset_clear(set) memset ((set)->bits, 0, sizeof((set)->bits))
+
+/*! Add header type to headers set. */
+#define amihdrset_add(set, hdr_type) (set)->bits[(hdr_type) / 8] |= 1 << ((hdr_type) % 8)
+
+/*! Check if header type is in headers set. */
+#define amihdrset_has(set, hdr_type) ((set)->bits[(hdr_type) / 8] & (1 << ((hdr_type) % 8)))
+
 /*! AMI headers types. Extracted from Asterisk source. */
 enum header_type {
 //{{{
@@ -105,6 +153,7 @@ enum header_type {
   // added later
   ActionID,                ExtraChannel,            ExtraContext,            ExtraPriority,
   Output,
+  HDR_CUSTOM,               /*!< First type of header registered with amiheader_register. */
 }; //}}}
 
 /*! AMI Event header types. Extracted from Asterisk source. */
@@ -199,6 +248,21 @@ typedef struct AMIVer_ {
   unsigned short patch; /*!< patch */
 } AMIVer;
 
+/*!
+ * Set of header types. Bit array indexed by enum header_type.
+ */
+typedef struct AMIHdrSet_ {
+  unsigned char bits[AMIHDR_SET_BITS / 8]; /*!< Header types bits. */
+} AMIHdrSet;
+
+/*!
+ * Set of event types. Bit array indexed by enum event_type.
+ * Use amihdrset_clear, amihdrset_add and amihdrset_has macros to manage it.
+ */
+typedef struct AMIEventSet_ {
+  unsigned char bits[AMIHDR_SET_BITS / 8]; /*!< Event types bits. */
+} AMIEventSet;
+
 /*!
  * AMI header structure.
  */
@@ -206,13 +270,27 @@ typedef struct AMIHeader_ {
 
   enum header_type    type;  /*!< AMI Header type. */
 
-  struct str         *name;  /*!< AMI header name as string. */
+  struct str         *name;  /*!< AMI header name as string. Points to static
+                                  names table for known header types. */
   struct str         *value; /*!< AMI header value as string. */
 
   struct AMIHeader_   *next; /*!< Next AMI header pointer. Linked list element. */
 
+  unsigned int        flags; /*!< Header memory flags. */
+
+  struct str          name_s;  /*!< Header name string storage. */
+  struct str          value_s; /*!< Header value string storage. */
+
+  char                inl[AMIHDR_INLINE_SIZE]; /*!< Short name and value copies. */
+
 } AMIHeader;
 
+/*! Memory block owned by AMI packet. */
+struct mem_block;
+
+/*! Packet header slot. */
+struct hdr_slot;
+
 /*!
  * AMI packet structure.
  */
@@ -224,15 +302,165 @@ typedef struct AMIPacket_ {
 
   enum pack_type  type;   /*!< AMI packet type: Action, Event etc. */
 
-  AMIHeader       *head;  /*!< Linked list head pointer to AMI header. */
+  enum event_type  event;  /*!< Event header value type. */
+  enum action_type action; /*!< Action header value type. */
+
+  AMIHeader       *head;  /*!< Linked list head pointer to AMI header. List is kept
+                               for compatibility, lazy packet builds it on decode. */
   AMIHeader       *tail;  /*!< Linked list tail pointer to AMI header. */
 
+  enum pack_mode  mode;   /*!< Packet memory mode. */
+
+  struct mem_block *mem;  /*!< Packet memory blocks list. */
+  struct mem_block *spare; /*!< Free memory blocks kept by amipack_reset. */
+  AMIHeader       *free_hdrs; /*!< Heap headers kept by amipack_reset for next appends. */
+
+  unsigned char   *types; /*!< Headers types in packet order (dense array). */
+  struct hdr_slot *slots; /*!< Headers slots in packet order. */
+  int             slots_size; /*!< Allocated size of types and slots arrays. */
+
+  AMIHdrSet       present;  /*!< Types of headers in packet. */
+  unsigned short  first[AMIHDR_SET_BITS]; /*!< Slot of first header of each present type. */
+  unsigned short  last[AMIHDR_SET_BITS];  /*!< Slot of last header of each present type. */
+
+  unsigned int    *names;     /*!< Hashed headers names index: slot + 1 or 0 if empty.
+                                   Built on first search by header name. */
+  int             names_size; /*!< Names index size, power of two. */
+  int             names_len;  /*!< Number of slots added to names index. */
+
+  int             refs;     /*!< References count. Packet is immutable when it is shared. */
+
 } AMIPacket;
 
+/*!
+ * Iterator over values of headers of one type.
+ */
+typedef struct AMIHdrIter_ {
+  AMIPacket         *pack;  /*!< Iterated packet. */
+  enum header_type  type;   /*!< Iterated header type. */
+  int               slot;   /*!< Slot of next header or -1 if iteration is done. */
+} AMIHdrIter;
+
+/*!
+ * Pool of AMI packets. Packets returned to pool are reset and
+ * reused with their headers memory.
+ */
+typedef struct AMIPackPool_ {
+
+  AMIPacket       **packs;  /*!< Free packets. */
+  int             len;      /*!< Number of free packets. */
+  int             size;     /*!< Maximum number of free packets. */
+
+  enum pack_mode  mode;     /*!< Memory mode of pool packets. */
+
+} AMIPackPool;
+
+/*!
+ * Pre-rendered AMI packet with placeholders for variable header values.
+ */
+typedef struct AMITemplate_ {
+  char    *buf;     /*!< Fixed packet text without placeholders values. */
+  size_t  len;      /*!< Fixed packet text length. */
+  size_t  *cuts;    /*!< Offsets in fixed text where values are inserted. */
+  int     size;     /*!< Number of placeholders. */
+} AMITemplate;
+
+/*!
+ * AMI packet builder. Writes headers directly to caller buffer.
+ */
+typedef struct AMIBuilder_ {
+  char    *buf;     /*!< Destination buffer. */
+  size_t  cap;      /*!< Destination buffer size. */
+  size_t  len;      /*!< Packet length, greater than cap when buffer is too small. */
+} AMIBuilder;
+
+/*!
+ * AMI stream parser structure. Collects bytes chunks received from
+ * server in one buffer, frames packets and parses every packet when
+ * it is complete. Packet parser is not resumable.
+ */
+typedef struct AMIStream_ {
+
+  char            *buf;     /*!< Received bytes buffer. */
+  size_t          len;      /*!< Number of bytes in buffer. */
+  size_t          size;     /*!< Buffer allocated size. */
+
+  size_t          start;    /*!< Offset of the next packet in buffer. */
+  size_t          scan;     /*!< Offset up to which packet end was searched. */
+
+  enum pack_mode  mode;     /*!< Memory mode of emitted packets. */
+
+  int             prompt;   /*!< Prompt line state. */
+  AMIVer          version;  /*!< AMI version from prompt line. */
+
+  unsigned long   errors;   /*!< Number of skipped invalid packets. */
+
+  const AMIEventSet *skip;  /*!< Events to drop without parsing or NULL. */
+  AMIPackPool     *pool;    /*!< Pool of emitted packets or NULL. */
+  unsigned long   skipped;  /*!< Number of dropped events. */
+  unsigned long   enomem;   /*!< Number of amistream_next calls stopped because
+                                 memory allocation failed. */
+
+} AMIStream;
+
+/*!
+ * AMI packets batch writer. Packets and templates are written back
+ * to back to one growable buffer that is flushed at once.
+ */
+typedef struct AMIWriter_ {
+
+  char            *buf;     /*!< Buffered bytes. */
+  size_t          len;      /*!< Number of bytes in buffer. */
+  size_t          size;     /*!< Buffer allocated size. */
+
+} AMIWriter;
+
+/*!
+ * Memory allocator used by library for all allocations.
+ * Functions receive allocator user data as last argument.
+ */
+typedef struct AMIAllocator_ {
+  void *(*alloc)(size_t size, void *ud);              /*!< Allocate memory, NULL on failure. */
+  void *(*realloc)(void *ptr, size_t size, void *ud); /*!< Resize memory, NULL on failure. */
+  void (*free)(void *ptr, void *ud);                  /*!< Free memory, ptr is never NULL. */
+  void *ud;                                           /*!< Allocator user data. */
+} AMIAllocator;
+
+/**
+ * Set memory allocator used by library. Allocator structure is copied.
+ * Must be called before any packet, header, stream or pool is created:
+ * memory is freed with allocator set at that moment. Allocator is global,
+ * per thread arenas can be selected by allocator functions.
+ * Allocation failures are reported by return values of library functions.
+ * @param alloc   Allocator or NULL to restore malloc, realloc and free.
+ */
+void amialloc_set(const AMIAllocator *alloc);
+
+/**
+ * Allocate memory with library allocator.
+ * @param size    Size in bytes
+ * @return pointer to memory or NULL if allocation failed.
+ */
+void *amialloc(size_t size);
+
+/**
+ * Resize memory allocated with library allocator.
+ * @param ptr     Memory pointer or NULL
+ * @param size    New size in bytes
+ * @return pointer to memory or NULL if allocation failed.
+ */
+void *amirealloc(void *ptr, size_t size);
+
+/**
+ * Free memory allocated with library allocator.
+ * @param ptr     Memory pointer or NULL
+ */
+void amifree(void *ptr);
+
 /**
  * Inititate string.
  * @param buf   Char array to set with struct str.
- * @return pointer to new struct str
+ * @return pointer to new struct str or NULL if memory allocation failed.
  */
 struct str *str_set (const char *buf);
 
@@ -245,10 +473,11 @@ void str_destroy (struct str *s);
 /**
  * Create new AMI header with given parameters.
  * Will allocated memory for AMIHeader and return pointer to it.
+ * Short name and value are copied to header inline buffer, long ones to heap.
  * @param type    AMI header type
  * @param name    AMI header name
  * @param value   AMI header value
- * @return AMIHeader pointer to the new structure.
+ * @return AMIHeader pointer to the new structure or NULL if memory allocation failed.
  */
 AMIHeader *amiheader_create (enum header_type type, const char *name, const char *value);
 
@@ -260,21 +489,96 @@ void amiheader_destroy (AMIHeader *hdr);
 
 /**
  * Initiate AMIPacket and allocate memory.
- * AMI packet is implemented as linked list data structure.
- * @return AMIPacket pointer to the new structure.
+ * Headers are stored in packet slot arrays: header types in dense types
+ * array and headers with their names and values in slots array, both
+ * in packet order. Headers are also linked in list from packet head.
+ * @return AMIPacket pointer to the new structure or NULL if memory allocation failed.
  */
 AMIPacket *amipack_init();
 
+/**
+ * Initiate AMIPacket with given memory mode.
+ * Packets in AMIPACK_VIEW and AMIPACK_LAZY modes keep headers in memory
+ * blocks owned by packet and header strings are not copied. Such packet
+ * is valid only while the strings appended to it are valid.
+ * @param mode    Packet memory mode
+ * @return AMIPacket pointer to the new structure or NULL if memory allocation failed.
+ */
+AMIPacket *amipack_init_mode(enum pack_mode mode);
+
 /**
  * Destroy AMI packet and free memory.
+ * Shared packet must be released with amipack_unref.
  * @param pack    AMI header to destroy
  */
 void amipack_destroy(AMIPacket *pack);
 
+/**
+ * Add reference to AMI packet. Packet with more than one reference
+ * is shared and immutable: headers can not be appended and reset is
+ * ignored. Headers of AMIPACK_LAZY packet and headers names index are
+ * created when packet becomes shared, so shared packet can be read
+ * from several threads. Reference counter is atomic.
+ * @param pack    AMI packet structure pointer
+ * @return packet pointer or NULL if memory allocation failed.
+ */
+AMIPacket *amipack_ref(AMIPacket *pack);
+
+/**
+ * Release reference to AMI packet. Packet is destroyed when
+ * last reference is released.
+ * @param pack    AMI packet structure pointer
+ */
+void amipack_unref(AMIPacket *pack);
+
+/*! Check if AMI packet is shared by several references. */
+#define amipack_shared(pack) (__atomic_load_n (&(pack)->refs, __ATOMIC_ACQUIRE) > 1)
+
+/**
+ * Remove all headers from AMI packet. Packet memory blocks and headers
+ * of AMIPACK_HEAP packet are kept and reused by new headers, so packet
+ * returned to pool does not allocate headers again. Packet memory mode
+ * is not changed.
+ * @param pack    AMI packet structure pointer
+ */
+void amipack_reset(AMIPacket *pack);
+
+/**
+ * Create pool of AMI packets.
+ * @param mode    Memory mode of pool packets.
+ * @param size    Maximum number of free packets kept by pool.
+ * @return AMIPackPool pointer or NULL if failed to allocate memory.
+ */
+AMIPackPool *amipool_init(enum pack_mode mode, int size);
+
+/**
+ * Destroy pool and all free packets it keeps.
+ * Packets taken from pool are not destroyed.
+ * @param pool    AMI packets pool pointer
+ */
+void amipool_destroy(AMIPackPool *pool);
+
+/**
+ * Take empty packet from pool. New packet is created when pool is empty.
+ * @param pool    AMI packets pool pointer
+ * @return AMIPacket pointer.
+ */
+AMIPacket *amipool_get(AMIPackPool *pool);
+
+/**
+ * Return packet to pool. Packet is reset and kept for reuse,
+ * or destroyed when pool is full or packet memory mode is not
+ * pool mode (packet was not taken from pool). Reference to shared
+ * packet is released instead.
+ * @param pool    AMI packets pool pointer
+ * @param pack    AMI packet taken from pool
+ */
+void amipool_put(AMIPackPool *pool, AMIPacket *pack);
+
 /**
  * Append header to AMI packet.
  * Will create new AMI header using given type and value string.
- * New header will be appanded to the head of linked list.
+ * New header will be appended to the end of packet slots and headers list.
  * @param pack      Pointer to AMI packet structure
  * @param hdr_type  AMI header type to create.
  * @param hdr_value AMI header value as string.
@@ -285,6 +589,7 @@ int amipack_append(AMIPacket *pack, enum header_type hdr_type, const char *hdr_v
 /**
  * Append AMI header to AMI packet when type is unknown.
  * Will create new AMI header with type HDR_UNKNOWN and set provided name and value.
+ * Header with name registered with amiheader_register gets registered type.
  * If AMI header is successfuly created, it will be appended to AMI packet.
  * @param pack      AMI packet structure pointer
  * @param name      AMI header name string
@@ -293,6 +598,32 @@ int amipack_append(AMIPacket *pack, enum header_type hdr_type, const char *hdr_v
  */
 int amipack_append_unknown(AMIPacket *pack, const char *name, const char *value);
 
+/**
+ * Append header with name and value given as length bounded strings.
+ * Name is used only for HDR_UNKNOWN type, otherwise header type name is set.
+ * Strings are copied unless packet is in AMIPACK_VIEW or AMIPACK_LAZY mode.
+ * @param pack      AMI packet structure pointer
+ * @param hdr_type  AMI header type to create.
+ * @param name      AMI header name (not required to be '\0' terminated)
+ * @param name_len  AMI header name length
+ * @param value     AMI header value (not required to be '\0' terminated)
+ * @param value_len AMI header value length
+ * @return -1 if error or RV_SUCCESS
+ */
+int amipack_append_n(AMIPacket *pack, enum header_type hdr_type,
+                     const char *name, size_t name_len,
+                     const char *value, size_t value_len);
+
+/**
+ * Create headers list of AMIPACK_LAZY packet. Headers list of lazy
+ * packet is empty until this function is called, so it must be called
+ * before iterating packet headers. Decoded packet becomes AMIPACK_VIEW packet.
+ * Does nothing for packets in other modes.
+ * @param pack      AMI packet structure pointer
+ * @return -1 if memory allocation failed or RV_SUCCESS
+ */
+int amipack_decode(AMIPacket *pack);
+
 /**
  * Append AMI header to packet.
  * @param pack      AMI packet structure pointer
@@ -312,10 +643,123 @@ int amiheader_to_str(AMIHeader *hdr, char *buf);
 /**
  * Convert AMIPacket to string.
  * @param pack      AMI packet structure pointer
- * @return pointer to AMI packet as string
+ * @return pointer to AMI packet as string, NULL if packet is empty
+ *         or memory allocation failed.
  */
 struct str *amipack_to_str(AMIPacket *pack);
 
+/**
+ * Write AMI packet to given buffer. Nothing is written when buffer
+ * is too small, so call can be repeated with buffer of returned size.
+ * Headers of AMIPACK_LAZY packet are not created. Result is not '\0' terminated.
+ * @param pack      AMI packet structure pointer
+ * @param dst       Destination buffer
+ * @param cap       Destination buffer size
+ * @return number of bytes written or required buffer size if it is
+ *         greater than cap. Zero for empty packet.
+ */
+size_t amipack_write(AMIPacket *pack, char *dst, size_t cap);
+
+/*! Number of iovec entries required to write AMI packet with amipack_iovec. */
+#define amipack_iovec_len(pack) ((pack)->size ? 4 * (pack)->size + 1 : 0)
+
+/**
+ * Fill iovec array with AMI packet bytes for writev. Entries point
+ * to headers names and values kept by packet and to static separators,
+ * nothing is copied. Entries are valid while packet is not changed.
+ * Every header takes four entries, packet end takes one. Packets with
+ * more than (IOV_MAX - 1) / 4 headers must be written with several writev calls.
+ * @param pack      AMI packet structure pointer
+ * @param iov       Array of iovec structures
+ * @param max       Size of iovec array
+ * @return number of entries filled or required array size (see amipack_iovec_len)
+ *         if it is greater than max. Nothing is filled in that case.
+ */
+int amipack_iovec(AMIPacket *pack, struct iovec *iov, int max);
+
+/**
+ * Create template from AMI packet. Headers of types from given set
+ * are placeholders, values of other headers are fixed. Placeholders
+ * are numbered in packet order. Packet is not needed after template
+ * is created. Headers with registered names (amiheader_register) can
+ * be placeholders too.
+ * @param pack      AMI packet structure pointer
+ * @param vars      Set of placeholders header types
+ * @return template pointer or NULL if packet is empty or memory allocation failed.
+ */
+AMITemplate *amitmpl_create(AMIPacket *pack, const AMIHdrSet *vars);
+
+/**
+ * Destroy template and free memory.
+ * @param tmpl      Template pointer
+ */
+void amitmpl_destroy(AMITemplate *tmpl);
+
+/**
+ * Write template with given placeholders values to buffer.
+ * Nothing is written when buffer is too small.
+ * @param tmpl      Template pointer
+ * @param values    Array of tmpl->size values, NULL value is empty
+ * @param dst       Destination buffer
+ * @param cap       Destination buffer size
+ * @return number of bytes written or required buffer size if it is
+ *         greater than cap.
+ */
+size_t amitmpl_write(const AMITemplate *tmpl, const char *const *values,
+                     char *dst, size_t cap);
+
+/**
+ * Start building AMI packet in given buffer. Builder does not allocate
+ * memory, headers are written to buffer as they are added.
+ * @param build     Builder structure pointer
+ * @param buf       Destination buffer
+ * @param cap       Destination buffer size
+ */
+void amibuild_begin(AMIBuilder *build, char *buf, size_t cap);
+
+/**
+ * Add header to built packet.
+ * @param build     Builder structure pointer
+ * @param type      Header type
+ * @param value     Header value, NULL is empty
+ * @return -1 if header type is invalid or RV_SUCCESS
+ */
+int amibuild_header(AMIBuilder *build, enum header_type type, const char *value);
+
+/**
+ * Add header with given name to built packet.
+ * @param build     Builder structure pointer
+ * @param name      Header name
+ * @param value     Header value, NULL is empty
+ */
+void amibuild_unknown(AMIBuilder *build, const char *name, const char *value);
+
+/**
+ * Add header with integer value to built packet.
+ * @param build     Builder structure pointer
+ * @param type      Header type
+ * @param value     Header value
+ * @return -1 if header type is invalid or RV_SUCCESS
+ */
+int amibuild_int(AMIBuilder *build, enum header_type type, long value);
+
+/**
+ * Add header with unsigned integer value to built packet.
+ * @param build     Builder structure pointer
+ * @param type      Header type
+ * @param value     Header value
+ * @return -1 if header type is invalid or RV_SUCCESS
+ */
+int amibuild_uint(AMIBuilder *build, enum header_type type, unsigned long value);
+
+/**
+ * Finish built packet.
+ * @param build     Builder structure pointer
+ * @return packet length or required buffer size if it is greater than
+ *         buffer size. Buffer content is not valid packet in that case.
+ */
+size_t amibuild_end(AMIBuilder *build);
+
 /**
  * Search header by header type. Will return value
  * if header in packet exists. Will return only first found
@@ -326,6 +770,22 @@ struct str *amipack_to_str(AMIPacket *pack);
  */
 struct str *amiheader_value(AMIPacket *pack, enum header_type type);
 
+/**
+ * Start iteration over values of all headers of given type.
+ * Headers are visited in packet order.
+ * @param iter      Iterator structure pointer
+ * @param pack      AMI packet structure pointer
+ * @param type      Header type to iterate
+ */
+void amiheader_iter(AMIHdrIter *iter, AMIPacket *pack, enum header_type type);
+
+/**
+ * Next header value of iterated type.
+ * @param iter      Iterator structure pointer
+ * @return NULL if there are no more headers or pointer to header value.
+ */
+struct str *amiheader_iter_next(AMIHdrIter *iter);
+
 /**
  * Search header by header name. Will return value
  * if header with given name in packet exists. Will return only
@@ -355,6 +815,40 @@ int amiparse_prompt (const char *packet, AMIVer *version);
  */
 int amiparse_stanza (const char *packet, int size);
 
+/**
+ * Find all packets boundaries in bytes array. Packet ends with
+ * "\r\n\r\n" bytes sequence. Uses AVX2 or SSE2 instructions when
+ * they are supported by CPU and byte by byte search otherwise.
+ * @param buf       Bytes array received from server.
+ * @param len       Bytes array length.
+ * @param ends      Array to store offsets of the bytes following each packet.
+ * @param max       Size of offsets array.
+ * @return number of packets ends found.
+ */
+int amiparse_frames (const char *buf, size_t len, size_t *ends, int max);
+
+/*! Packets framer implementations. */
+enum frame_impl {
+  FRAME_AUTO,   /*!< Fastest implementation supported by CPU. */
+  FRAME_SCALAR, /*!< Byte by byte search. */
+  FRAME_SSE2,   /*!< SSE2 instructions. */
+  FRAME_AVX2,   /*!< AVX2 instructions. */
+};
+
+/**
+ * Find all packets boundaries with given framer implementation.
+ * Same as amiparse_frames, used to test and compare implementations.
+ * @param buf       Bytes array received from server.
+ * @param len       Bytes array length.
+ * @param ends      Array to store offsets of the bytes following each packet.
+ * @param max       Size of offsets array.
+ * @param impl      Framer implementation.
+ * @return number of packets ends found or -1 if implementation
+ *         is not supported by CPU or build.
+ */
+int amiparse_frames_impl (const char *buf, size_t len, size_t *ends, int max,
+                          enum frame_impl impl);
+
 /**
  * Get sub string from given string.
  * @param s       Source string
@@ -371,6 +865,212 @@ char *substr(const char* s, size_t len, size_t offset);
  */
 AMIPacket *amiparse_pack (const char *pack_str);
 
+/**
+ * Parse AMI packet to AMIPacket structure without copying.
+ * Packet headers are allocated in packet memory and header names and
+ * values point to the parsed bytes array. Values are not '\0' terminated.
+ * Packet is valid as long as pack_str is valid.
+ * @param pack_str  Bytes array received from server.
+ * @return AMIPacket pointer or NULL if AMI packet failed to parse.
+ */
+AMIPacket *amiparse_pack_view (const char *pack_str);
+
+/**
+ * Parse AMI packet from bytes array of given length.
+ * Bytes array is not required to be '\0' terminated, so packet can be
+ * parsed in place inside of bigger receive buffer. Scanner never reads
+ * bytes after buf + len.
+ * @param buf       Bytes array received from server.
+ * @param len       Packet length in bytes array.
+ * @param mode      Packet memory mode. AMIPACK_VIEW and AMIPACK_LAZY
+ *                  packets are valid as long as buf is valid.
+ * @return AMIPacket pointer or NULL if AMI packet failed to parse.
+ */
+AMIPacket *amiparse_pack_n (const char *buf, size_t len, enum pack_mode mode);
+
+/**
+ * Parse AMI packet and keep only headers of wanted types. Other
+ * headers are skipped: their values are neither copied nor allocated.
+ * Packet type is detected even when Action/Event/Response header is not wanted.
+ * To keep headers with unknown names add HDR_UNKNOWN to the set.
+ * @param buf       Bytes array received from server.
+ * @param len       Packet length in bytes array.
+ * @param mode      Packet memory mode.
+ * @param wanted    Set of header types to keep. NULL keeps all headers.
+ * @return AMIPacket pointer or NULL if AMI packet failed to parse.
+ */
+AMIPacket *amiparse_pack_select (const char *buf, size_t len,
+                                 enum pack_mode mode, const AMIHdrSet *wanted);
+
+/**
+ * Parse AMI packet to packet taken from pool.
+ * Packet must be returned to pool with amipool_put.
+ * @param pool      AMI packets pool pointer
+ * @param buf       Bytes array received from server.
+ * @param len       Packet length in bytes array.
+ * @return AMIPacket pointer or NULL if AMI packet failed to parse.
+ */
+AMIPacket *amiparse_pack_pool (AMIPackPool *pool, const char *buf, size_t len);
+
+/**
+ * Parse AMI packet to given empty packet. Unlike functions returning
+ * new packet, tells invalid packet from memory allocation failure.
+ * Packet keeps headers parsed before failure and must be reset
+ * before it is used again.
+ * @param pack      Empty AMI packet, e.g. taken from pool.
+ * @param buf       Bytes array received from server.
+ * @param len       Packet length in bytes array.
+ * @return RV_SUCCESS, RV_FAIL if AMI packet failed to parse or packet
+ *         is not empty, RV_ENOMEM if memory allocation failed.
+ */
+int amiparse_pack_to (AMIPacket *pack, const char *buf, size_t len);
+
+/**
+ * Parse all complete packets from bytes array. Packets ends are found
+ * by amiparse_frames first, then every packet is parsed from its start,
+ * so packet bytes are read twice.
+ * Bytes array can contain many packets followed by incomplete packet.
+ * Invalid packets are skipped. Parsing stops when packets array is full.
+ * @param buf       Bytes array received from server.
+ * @param len       Bytes array length.
+ * @param mode      Packets memory mode. AMIPACK_VIEW and AMIPACK_LAZY
+ *                  packets are valid as long as buf is valid.
+ * @param pool      Pool to take packets from or NULL to create new packets.
+ *                  Pool packets keep pool memory mode, mode is ignored, and
+ *                  must be returned to pool with amipool_put.
+ * @param packs     Array to store parsed packets pointers.
+ * @param max       Size of packets array.
+ * @param consumed  If not NULL, set to number of bytes of all processed
+ *                  packets. Incomplete packet, or packet not parsed because
+ *                  memory allocation failed, starts at this offset.
+ * @return number of parsed packets stored in packs array, or -1 if memory
+ *         allocation failed before any packet was parsed.
+ */
+int amiparse_batch (const char *buf, size_t len, enum pack_mode mode,
+                    AMIPackPool *pool, AMIPacket **packs, int max, size_t *consumed);
+
+/**
+ * Get event type of the packet from its first header without parsing packet.
+ * Only first header is checked, as Asterisk always sends "Event" header first.
+ * @param buf       Bytes array with packet.
+ * @param len       Packet length in bytes array.
+ * @return Event type or EVENT_UNKNOWN if first header is not known event.
+ */
+enum event_type amiparse_event (const char *buf, size_t len);
+
+/**
+ * Create AMI stream parser.
+ * Packets emitted in AMIPACK_VIEW and AMIPACK_LAZY modes point to stream
+ * buffer and are valid only until next amistream_feed call, decoding
+ * lazy packet does not copy its strings.
+ * @param mode      Memory mode of emitted packets.
+ * @return AMIStream pointer or NULL if failed to allocate memory.
+ */
+AMIStream *amistream_init (enum pack_mode mode);
+
+/**
+ * Destroy AMI stream parser and free memory.
+ * Packets emitted by stream are not destroyed.
+ * @param stream    AMI stream structure pointer
+ */
+void amistream_destroy (AMIStream *stream);
+
+/**
+ * Add bytes chunk received from server to the stream.
+ * Chunk can contain any part of packet or several packets.
+ * Chunk is copied to stream buffer, nothing is parsed until amistream_next.
+ * @param stream    AMI stream structure pointer
+ * @param data      Bytes received from server
+ * @param len       Number of bytes
+ * @return RV_SUCCESS or RV_FAIL if failed to allocate memory.
+ */
+int amistream_feed (AMIStream *stream, const char *data, size_t len);
+
+/**
+ * Drop events of given types before they are parsed. Event type is
+ * detected by amiparse_event, so dropped packets cost a short scan
+ * of the first header only. Dropped packets are counted in stream skipped field.
+ * @param stream    AMI stream structure pointer
+ * @param skip      Set of event types to drop. Must be valid while stream is used.
+ *                  NULL disables filter. EVENT_UNKNOWN in set drops
+ *                  all packets that are not known events.
+ */
+void amistream_skip (AMIStream *stream, const AMIEventSet *skip);
+
+/**
+ * Emit stream packets from pool. Packets must be returned with amipool_put.
+ * Packets memory mode is pool mode, AMIPACK_VIEW and AMIPACK_LAZY packets
+ * are valid only until next amistream_feed call.
+ * @param stream    AMI stream structure pointer
+ * @param pool      Packets pool. Must be valid while stream is used.
+ *                  NULL creates new packet for every packet.
+ */
+void amistream_pool (AMIStream *stream, AMIPackPool *pool);
+
+/**
+ * Get next complete packet from the stream.
+ * Stream works in two passes: received bytes are scanned for packet
+ * end ("\r\n\r\n") only once, search resumes where previous call
+ * stopped, then every complete packet is parsed again from its start by
+ * packet parser. So packet bytes are scanned twice, dropped events are
+ * scanned once plus their first header. Prompt line at the stream
+ * start is emitted as AMI_PROMPT packet without headers and server
+ * version is stored in stream version field. Invalid packets are skipped.
+ * Events in set given to amistream_skip are dropped. When packet can not
+ * be allocated, stream enomem counter is incremented and the packet stays
+ * in stream, so next call retries it.
+ * @param stream    AMI stream structure pointer
+ * @return AMIPacket pointer or NULL if there is no complete packet
+ *         or memory allocation failed.
+ */
+AMIPacket *amistream_next (AMIStream *stream);
+
+/**
+ * Create AMI packets batch writer.
+ * @return AMIWriter pointer or NULL if failed to allocate memory.
+ */
+AMIWriter *amiwriter_init (void);
+
+/**
+ * Destroy AMI packets batch writer and free memory.
+ * Buffered bytes are dropped.
+ * @param writer    AMI writer structure pointer
+ */
+void amiwriter_destroy (AMIWriter *writer);
+
+/**
+ * Append AMI packet to writer buffer.
+ * @param writer    AMI writer structure pointer
+ * @param pack      AMI packet structure pointer
+ * @return RV_SUCCESS or RV_FAIL if failed to allocate memory.
+ */
+int amiwriter_pack (AMIWriter *writer, AMIPacket *pack);
+
+/**
+ * Append template with given placeholders values to writer buffer.
+ * @param writer    AMI writer structure pointer
+ * @param tmpl      Template pointer
+ * @param values    Array of tmpl->size values, NULL value is empty
+ * @return RV_SUCCESS or RV_FAIL if failed to allocate memory.
+ */
+int amiwriter_tmpl (AMIWriter *writer, const AMITemplate *tmpl,
+                    const char *const *values);
+
+/**
+ * Write buffered bytes to file descriptor. Interrupted writes are
+ * repeated. On error written bytes are removed from buffer and the
+ * rest is kept for next flush (e.g. after EAGAIN on non blocking socket).
+ * Buffer can be sent by other means using writer buf and len fields
+ * and emptied with amiwriter_clear.
+ * @param writer    AMI writer structure pointer
+ * @param fd        File descriptor
+ * @return RV_SUCCESS if all bytes are written or RV_FAIL, errno is set by write.
+ */
+int amiwriter_flush (AMIWriter *writer, int fd);
+
+/*! Drop bytes buffered in AMI writer. Buffer memory is kept. */
+#define amiwriter_clear(writer) ((writer)->len = 0)
+
 /**
  * AMI packet type name
  * @param type      AMI packet type.
@@ -385,4 +1085,62 @@ const char *pack_type_str(enum pack_type type);
  */
 const char *header_name(enum header_type type);
 
+/**
+ * Register additional header name. Registered header gets own type
+ * recognised by packet parser and by amipack_append_unknown, so its
+ * value is found with amiheader_value and filtered with AMIHdrSet.
+ * Registry is not thread safe: headers must be registered at startup,
+ * before packets are parsed or created.
+ * @param name      Header name. Must not contain ':', ' ', '\r' or '\n'.
+ * @return Header type (HDR_CUSTOM or greater), type of already registered
+ *         or built-in header with this name, or -1 if name is invalid or
+ *         registry is full.
+ */
+int amiheader_register(const char *name);
+
+/**
+ * Remove all registered header names and free registry memory.
+ * Packets with registered headers must be destroyed before.
+ */
+void amiheader_unregister_all(void);
+
+/**
+ * Header type of header name registered with amiheader_register.
+ * Case insensitive. Built-in header names are recognised by parser.
+ * @param name      Header name (not required to be '\0' terminated).
+ * @param len       Header name length.
+ * @return Registered header type or HDR_UNKNOWN.
+ */
+enum header_type header_type_id(const char *name, size_t len);
+
+/**
+ * Event type for given Event header value. Case insensitive.
+ * @param name      Event name (not required to be '\0' terminated).
+ * @param len       Event name length.
+ * @return Event type or EVENT_UNKNOWN.
+ */
+enum event_type event_type_id(const char *name, size_t len);
+
+/**
+ * Action type for given Action header value. Case insensitive.
+ * @param name      Action name (not required to be '\0' terminated).
+ * @param len       Action name length.
+ * @return Action type or ACTION_UNKNOWN.
+ */
+enum action_type action_type_id(const char *name, size_t len);
+
+/**
+ * Event name representation for given type.
+ * @param type      AMI event type.
+ * @return Event name as string. Pointer to char array.
+ */
+const char *event_name(enum event_type type);
+
+/**
+ * Action name representation for given type.
+ * @param type      AMI action type.
+ * @return Action name as string. Pointer to char array.
+ */
+const char *action_name(enum action_type type);
+
 #endif
@@ -0,0 +1,137 @@
+/**
+ * libamip -- Library with functions for read/create AMI packets
+ * Copyright (C) 2016, Stas Kobzar <staskobzar@modulis.ca>
+ *
+ * This file is part of libamip.
+ *
+ * libamip is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libamip is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libamip.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file pack_writer.c
+ * @brief AMI (Asterisk Management Interface) packets batch writer.
+ * Collects outgoing packets in one buffer written with few syscalls.
+ *
+ * @author Stas Kobzar <stas.kobzar@modulis.ca>
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "amip.h"
+
+/*! Initial size of writer buffer. */
+#define WRITER_BUF_SIZE 4096
+
+/**
+ * Make room for given number of bytes in writer buffer.
+ * Buffer grows twice until bytes fit.
+ * @param writer    AMI writer structure pointer
+ * @param len       Number of bytes to add
+ * @return RV_SUCCESS or RV_FAIL if failed to allocate memory.
+ */
+static int writer_reserve (AMIWriter *writer, size_t len)
+{
+  size_t size;
+  char *buf;
+
+  if (writer->len + len <= writer->size)
+    return RV_SUCCESS;
+
+  size = writer->size ? writer->size : WRITER_BUF_SIZE;
+  while (size < writer->len + len)
+    size *= 2;
+
+  buf = (char *) amirealloc (writer->buf, size);
+  if (buf == NULL)
+    return RV_FAIL;
+  writer->buf = buf;
+  writer->size = size;
+
+  return RV_SUCCESS;
+}
+
+AMIWriter *amiwriter_init (void)
+{
+  AMIWriter *writer = (AMIWriter *) amialloc (sizeof (AMIWriter));
+  if (writer == NULL)
+    return NULL;
+
+  writer->buf = NULL;
+  writer->len = 0;
+  writer->size = 0;
+
+  return writer;
+}
+
+void amiwriter_destroy (AMIWriter *writer)
+{
+  if (writer) {
+    amifree (writer->buf);
+    amifree (writer);
+  }
+}
+
+int amiwriter_pack (AMIWriter *writer, AMIPacket *pack)
+{
+  size_t len = amipack_length (pack);
+
+  if (pack->size == 0)
+    return RV_SUCCESS;
+
+  if (writer_reserve (writer, len) != RV_SUCCESS)
+    return RV_FAIL;
+
+  writer->len += amipack_write (pack, writer->buf + writer->len, len);
+  return RV_SUCCESS;
+}
+
+int amiwriter_tmpl (AMIWriter *writer, const AMITemplate *tmpl,
+                    const char *const *values)
+{
+  // template is not written to empty buffer, only its size is returned
+  size_t len = amitmpl_write (tmpl, values, NULL, 0);
+
+  if (writer_reserve (writer, len) != RV_SUCCESS)
+    return RV_FAIL;
+
+  writer->len += amitmpl_write (tmpl, values, writer->buf + writer->len, len);
+  return RV_SUCCESS;
+}
+
+int amiwriter_flush (AMIWriter *writer, int fd)
+{
+  size_t done = 0;
+  ssize_t n;
+  int rv = RV_SUCCESS;
+
+  while (done < writer->len) {
+    n = write (fd, writer->buf + done, writer->len - done);
+    if (n < 0) {
+      if (errno == EINTR)
+        continue;
+      rv = RV_FAIL;
+      break;
+    }
+    done += n;
+  }
+
+  // keep bytes that are not written
+  if (done < writer->len)
+    memmove (writer->buf, writer->buf + done, writer->len - done);
+  writer->len -= done;
+
+  return rv;
+}
@@ -0,0 +1,179 @@
+/**
+ * libamip -- Library with functions for read/create AMI packets
+ * Copyright (C) 2016, Stas Kobzar <staskobzar@modulis.ca>
+ *
+ * This file is part of libamip.
+ *
+ * libamip is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libamip is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libamip.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file parse_frame.c
+ * @brief AMI (Asterisk Management Interface) packets framer.
+ * Finds packets boundaries ("\r\n\r\n" stanza) in received bytes.
+ * Uses SSE2 or AVX2 instructions when CPU supports them.
+ *
+ * @author Stas Kobzar <stas.kobzar@modulis.ca>
+ */
+
+#include <string.h>
+
+#include "amip.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define FRAME_X86 1
+#include <immintrin.h>
+#endif
+
+/**
+ * Find packets ends byte by byte.
+ * @param buf     Bytes array
+ * @param len     Bytes array length
+ * @param pos     Offset to start search from
+ * @param ends    Array of packets ends offsets
+ * @param n       Number of offsets already found
+ * @param max     Size of offsets array
+ * @return number of offsets found.
+ */
+static int frames_scalar (const char *buf, size_t len, size_t pos,
+                          size_t *ends, int n, int max)
+{
+  const char *p = buf + pos, *end = buf + len;
+
+  while (n < max && end - p >= 4) {
+    p = memchr (p, '\r', end - p - 3);
+    if (p == NULL)
+      break;
+    if (p[1] == '\n' && p[2] == '\r' && p[3] == '\n') {
+      p += 4;
+      ends[n++] = p - buf;
+    } else {
+      p++;
+    }
+  }
+
+  return n;
+}
+
+#ifdef FRAME_X86
+
+/**
+ * Add stanzas found in block to offsets array.
+ * Stanzas overlapping previous one are ignored.
+ * @param mask    Bit mask of stanzas starts in block
+ * @param at      Block offset
+ * @param pos     Offset after last found stanza
+ * @param ends    Array of packets ends offsets
+ * @param n       Number of offsets already found
+ * @param max     Size of offsets array
+ * @return number of offsets found.
+ */
+static inline int frames_mask (unsigned int mask, size_t at, size_t *pos,
+                               size_t *ends, int n, int max)
+{
+  while (mask && n < max) {
+    size_t start = at + __builtin_ctz (mask);
+    mask &= mask - 1;
+    if (start < *pos)
+      continue;
+    *pos = start + 4;
+    ends[n++] = *pos;
+  }
+  return n;
+}
+
+__attribute__((target("sse2")))
+static int frames_sse2 (const char *buf, size_t len, size_t *ends, int max)
+{
+  const __m128i cr = _mm_set1_epi8 ('\r');
+  const __m128i lf = _mm_set1_epi8 ('\n');
+  size_t i = 0, pos = 0;
+  int n = 0;
+
+  // every block is compared with itself shifted by 1, 2 and 3 bytes
+  for (; n < max && i + 16 + 3 <= len; i += 16) {
+    __m128i b0 = _mm_loadu_si128 ((const __m128i *)(buf + i));
+    __m128i m  = _mm_cmpeq_epi8 (b0, cr);
+    if (_mm_movemask_epi8 (m) == 0)
+      continue;
+    m = _mm_and_si128 (m, _mm_cmpeq_epi8 (_mm_loadu_si128 ((const __m128i *)(buf + i + 1)), lf));
+    m = _mm_and_si128 (m, _mm_cmpeq_epi8 (_mm_loadu_si128 ((const __m128i *)(buf + i + 2)), cr));
+    m = _mm_and_si128 (m, _mm_cmpeq_epi8 (_mm_loadu_si128 ((const __m128i *)(buf + i + 3)), lf));
+    n = frames_mask ((unsigned int)_mm_movemask_epi8 (m), i, &pos, ends, n, max);
+  }
+
+  return frames_scalar (buf, len, i > pos ? i : pos, ends, n, max);
+}
+
+__attribute__((target("avx2")))
+static int frames_avx2 (const char *buf, size_t len, size_t *ends, int max)
+{
+  const __m256i cr = _mm256_set1_epi8 ('\r');
+  const __m256i lf = _mm256_set1_epi8 ('\n');
+  size_t i = 0, pos = 0;
+  int n = 0;
+
+  for (; n < max && i + 32 + 3 <= len; i += 32) {
+    __m256i b0 = _mm256_loadu_si256 ((const __m256i *)(buf + i));
+    __m256i m  = _mm256_cmpeq_epi8 (b0, cr);
+    if (_mm256_movemask_epi8 (m) == 0)
+      continue;
+    m = _mm256_and_si256 (m, _mm256_cmpeq_epi8 (_mm256_loadu_si256 ((const __m256i *)(buf + i + 1)), lf));
+    m = _mm256_and_si256 (m, _mm256_cmpeq_epi8 (_mm256_loadu_si256 ((const __m256i *)(buf + i + 2)), cr));
+    m = _mm256_and_si256 (m, _mm256_cmpeq_epi8 (_mm256_loadu_si256 ((const __m256i *)(buf + i + 3)), lf));
+    n = frames_mask ((unsigned int)_mm256_movemask_epi8 (m), i, &pos, ends, n, max);
+  }
+
+  return frames_scalar (buf, len, i > pos ? i : pos, ends, n, max);
+}
+
+#endif
+
+int amiparse_frames_impl (const char *buf, size_t len, size_t *ends, int max,
+                          enum frame_impl impl)
+{
+  if (impl == FRAME_AUTO)
+    return amiparse_frames (buf, len, ends, max);
+
+  if (max <= 0)
+    return 0;
+
+  switch (impl) {
+#ifdef FRAME_X86
+    case FRAME_AVX2:
+      return __builtin_cpu_supports ("avx2") ? frames_avx2 (buf, len, ends, max) : -1;
+    case FRAME_SSE2:
+      return __builtin_cpu_supports ("sse2") ? frames_sse2 (buf, len, ends, max) : -1;
+#endif
+    case FRAME_SCALAR:
+      return frames_scalar (buf, len, 0, ends, 0, max);
+    default:
+      return -1;
+  }
+}
+
+int amiparse_frames (const char *buf, size_t len, size_t *ends, int max)
+{
+  if (max <= 0)
+    return 0;
+
+#ifdef FRAME_X86
+  if (__builtin_cpu_supports ("avx2"))
+    return frames_avx2 (buf, len, ends, max);
+  if (__builtin_cpu_supports ("sse2"))
+    return frames_sse2 (buf, len, ends, max);
+#endif
+
+  return frames_scalar (buf, len, 0, ends, 0, max);
+}
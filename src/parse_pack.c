@@ -28,6 +28,7 @@
  */
 
 #include <stdio.h>
+#include <stdint.h>
 #include <string.h>
 #include "amip.h"
 
@@ -35,10 +36,36 @@
  * Commands to run when standard header parsed.
  * @param flag    Header type
  */
-#define SET_HEADER(flag)  len = cur - tok; \
+#define SET_HEADER(flag)  hdr_name = tok; \
+                          hdr_len = cur - tok; \
                           hdr_type = flag; \
                           goto yyc_key;
 
+/**
+ * Check if header of given type must be added to packet.
+ * @param type    Header type
+ */
+#define WANTED(type) (wanted == NULL || amihdrset_has (wanted, type))
+
+/**
+ * Fail on header line without header name: packet starts with ':'.
+ * Other lines are scanned as header lines only when they start with a letter.
+ */
+#define NAMED_HEADER() do { if (hdr_name == NULL) goto fail; } while (0)
+
+/**
+ * Append header to packet if it is wanted. Parsing stops with
+ * RV_ENOMEM when header can not be allocated.
+ * @param type    Header type
+ */
+#define APPEND_HEADER(type, name, name_len, value, value_len) \
+                          do { \
+                            if (WANTED(type) && \
+                                amipack_append_n (pack, type, name, name_len, \
+                                                  value, value_len) != RV_SUCCESS) \
+                              goto nomem; \
+                          } while (0)
+
 /**
  * Commands to run on Command AMI response header.
  * @param offset  Header name offset
@@ -47,9 +74,20 @@
 #define CMD_HEADER(offset, flag) len = cur - tok - offset; tok += offset; \
                           while(*tok == ' ') { tok++; len--; } \
                           len -= 2; \
-                          char *val = substr(tok, len, 0); \
-                          amipack_append (pack, flag, val); \
-                          if(val){free(val);}; tok = cur; goto yyc_command;
+                          APPEND_HEADER(flag, NULL, 0, tok, len); \
+                          tok = cur; goto yyc_command;
+
+/*
+ * re2c generic input API (re2c --input custom).
+ * Input is bounded by "size" bytes from "buf": characters at or after
+ * the limit are read as '\0' and scanner fails if it tries to consume them.
+ */
+#define YYPEEK()        ((size_t)(cur - buf) < size ? (unsigned char)*cur : '\0')
+#define YYSKIP()        do { if ((size_t)(++cur - buf) > size) goto fail; } while (0)
+#define YYBACKUP()      marker = cur
+#define YYBACKUPCTX()   ctxmarker = cur
+#define YYRESTORE()     cur = marker
+#define YYRESTORECTX()  cur = ctxmarker
 
 // introducing types:re2c for AMI packet
 /*! re2c parcing conditions. */
@@ -59,21 +97,31 @@ enum yycond_pack {
   yyccommand,
 };
 
-AMIPacket *amiparse_pack (const char *pack_str)
+/**
+ * Parse AMI packet headers to given packet.
+ * @param pack      Empty AMI packet
+ * @param buf       Bytes array received from server
+ * @param size      Packet length in bytes array
+ * @param wanted    Set of header types to keep or NULL
+ * @return RV_SUCCESS, RV_FAIL if AMI packet failed to parse
+ *         or RV_ENOMEM if memory allocation failed.
+ */
+static int parse_pack (AMIPacket *pack, const char *buf, size_t size,
+                       const AMIHdrSet *wanted)
 {
-  AMIPacket *pack = amipack_init ();
-  enum header_type hdr_type;
-  const char *marker = pack_str;
+  enum header_type hdr_type = HDR_UNKNOWN;
+  const char *marker = buf;
   const char *cur    = marker;
   const char *ctxmarker;
   int c = yyckey;
   int len = 0;
 
   const char *tok = marker;
-  char *hdr_name;
+  const char *hdr_name = NULL;
+  size_t hdr_len = 0;
 
 
-#line 77 "parse_pack.c"
+#line 125 "parse_pack.c"
 {
 	unsigned char yych;
 	unsigned int yyaccept = 0;
@@ -84,7 +132,7 @@ AMIPacket *amiparse_pack (const char *pack_str)
 	}
 /* *********************************** */
 yyc_command:
-	yych = *cur;
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy5;
 	case '-':	goto yy7;
@@ -100,32 +148,34 @@ yyc_command:
 	}
 yy3:
 	yyaccept = 0;
-	yych = *(marker = ++cur);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	goto yy13;
 yy4:
-#line 232 "parse_pack.re"
-	{
-              if (hdr_name) free (hdr_name);
-              amipack_destroy (pack);
-              return NULL;
-            }
-#line 113 "parse_pack.c"
+#line 277 "parse_pack.re"
+	{ goto fail; }
+#line 159 "parse_pack.c"
 yy5:
-	++cur;
+	YYSKIP ();
 yy6:
-#line 444 "parse_pack.re"
+#line 480 "parse_pack.re"
 	{ goto yyc_command; }
-#line 119 "parse_pack.c"
+#line 165 "parse_pack.c"
 yy7:
 	yyaccept = 0;
-	yych = *(marker = ++cur);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '-':	goto yy62;
 	default:	goto yy13;
 	}
 yy8:
 	yyaccept = 0;
-	yych = *(marker = ++cur);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy49;
@@ -133,7 +183,9 @@ yy8:
 	}
 yy9:
 	yyaccept = 0;
-	yych = *(marker = ++cur);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy37;
@@ -141,7 +193,9 @@ yy9:
 	}
 yy10:
 	yyaccept = 0;
-	yych = *(marker = ++cur);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy29;
@@ -149,403 +203,452 @@ yy10:
 	}
 yy11:
 	yyaccept = 0;
-	yych = *(marker = ++cur);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy15;
 	default:	goto yy13;
 	}
 yy12:
-	++cur;
-	yych = *cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 yy13:
 	switch (yych) {
 	case '\n':	goto yy14;
 	default:	goto yy12;
 	}
 yy14:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy6;
 yy15:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy16;
 	default:	goto yy13;
 	}
 yy16:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'V':
 	case 'v':	goto yy17;
 	default:	goto yy13;
 	}
 yy17:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy18;
 	default:	goto yy13;
 	}
 yy18:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy19;
 	default:	goto yy13;
 	}
 yy19:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy20;
 	default:	goto yy13;
 	}
 yy20:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy21;
 	default:	goto yy13;
 	}
 yy21:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy22;
 	default:	goto yy13;
 	}
 yy22:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case ':':	goto yy23;
 	default:	goto yy13;
 	}
 yy23:
-	++cur;
-	yych = *cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy14;
 	case '\r':	goto yy25;
 	default:	goto yy23;
 	}
 yy25:
-	++cur;
-	yych = *cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy27;
 	case '\r':	goto yy25;
 	default:	goto yy23;
 	}
 yy27:
-	++cur;
-#line 440 "parse_pack.re"
+	YYSKIP ();
+#line 476 "parse_pack.re"
 	{ CMD_HEADER(10, Privilege); }
-#line 245 "parse_pack.c"
+#line 310 "parse_pack.c"
 yy29:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy30;
 	default:	goto yy13;
 	}
 yy30:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy31;
 	default:	goto yy13;
 	}
 yy31:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy32;
 	default:	goto yy13;
 	}
 yy32:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy33;
 	default:	goto yy13;
 	}
 yy33:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case ':':	goto yy34;
 	default:	goto yy13;
 	}
 yy34:
 	yyaccept = 1;
-	yych = *(marker = ++cur);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case ' ':	goto yy36;
 	default:	goto yy13;
 	}
 yy35:
-#line 443 "parse_pack.re"
+#line 479 "parse_pack.re"
 	{ tok = cur; goto yyc_command; }
-#line 290 "parse_pack.c"
+#line 362 "parse_pack.c"
 yy36:
 	yyaccept = 1;
-	yych = *(marker = ++cur);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	goto yy13;
 yy37:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy38;
 	default:	goto yy13;
 	}
 yy38:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy39;
 	default:	goto yy13;
 	}
 yy39:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy40;
 	default:	goto yy13;
 	}
 yy40:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy41;
 	default:	goto yy13;
 	}
 yy41:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy42;
 	default:	goto yy13;
 	}
 yy42:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case ':':	goto yy43;
 	default:	goto yy13;
 	}
 yy43:
-	++cur;
-	yych = *cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy14;
 	case '\r':	goto yy45;
 	default:	goto yy43;
 	}
 yy45:
-	++cur;
-	yych = *cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy47;
 	case '\r':	goto yy45;
 	default:	goto yy43;
 	}
 yy47:
-	++cur;
-#line 442 "parse_pack.re"
+	YYSKIP ();
+#line 478 "parse_pack.re"
 	{ CMD_HEADER(8, Message); }
-#line 356 "parse_pack.c"
+#line 436 "parse_pack.c"
 yy49:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy50;
 	default:	goto yy13;
 	}
 yy50:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy51;
 	default:	goto yy13;
 	}
 yy51:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy52;
 	default:	goto yy13;
 	}
 yy52:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy53;
 	default:	goto yy13;
 	}
 yy53:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy54;
 	default:	goto yy13;
 	}
 yy54:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy55;
 	default:	goto yy13;
 	}
 yy55:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case ':':	goto yy56;
 	default:	goto yy13;
 	}
 yy56:
-	++cur;
-	yych = *cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy14;
 	case '\r':	goto yy58;
 	default:	goto yy56;
 	}
 yy58:
-	++cur;
-	yych = *cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy60;
 	case '\r':	goto yy58;
 	default:	goto yy56;
 	}
 yy60:
-	++cur;
-#line 441 "parse_pack.re"
+	YYSKIP ();
+#line 477 "parse_pack.re"
 	{ CMD_HEADER(9, ActionID); }
-#line 425 "parse_pack.c"
+#line 512 "parse_pack.c"
 yy62:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':	goto yy63;
 	default:	goto yy13;
 	}
 yy63:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':	goto yy64;
 	default:	goto yy13;
 	}
 yy64:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':	goto yy65;
 	default:	goto yy13;
 	}
 yy65:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case ' ':	goto yy66;
 	default:	goto yy13;
 	}
 yy66:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':	goto yy67;
 	default:	goto yy13;
 	}
 yy67:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':	goto yy68;
 	default:	goto yy13;
 	}
 yy68:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':	goto yy69;
 	default:	goto yy13;
 	}
 yy69:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':	goto yy70;
 	default:	goto yy13;
 	}
 yy70:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':	goto yy71;
 	default:	goto yy13;
 	}
 yy71:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':	goto yy72;
 	default:	goto yy13;
 	}
 yy72:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':	goto yy73;
 	default:	goto yy13;
 	}
 yy73:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '-':	goto yy74;
 	default:	goto yy13;
 	}
 yy74:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '-':	goto yy75;
 	default:	goto yy13;
 	}
 yy75:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\r':	goto yy76;
 	default:	goto yy13;
 	}
 yy76:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy77;
 	default:	goto yy12;
 	}
 yy77:
 	yyaccept = 2;
-	yych = *(marker = ++cur);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\r':	goto yy78;
 	default:	goto yy6;
 	}
 yy78:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy80;
 	default:	goto yy79;
 	}
 yy79:
-	cur = marker;
+	YYRESTORE ();
 	switch (yyaccept) {
 	case 0: 	goto yy4;
 	case 1: 	goto yy35;
 	default:	goto yy6;
 	}
 yy80:
-	++cur;
-#line 445 "parse_pack.re"
+	YYSKIP ();
+#line 481 "parse_pack.re"
 	{
               len = cur - tok - 19; // output minus command end tag
-              char *val = substr(tok, len, 0);
-              amipack_append (pack, Output, val);
-              if(val) free (val);
+              APPEND_HEADER(Output, NULL, 0, tok, len);
               goto done;
             }
-#line 546 "parse_pack.c"
+#line 649 "parse_pack.c"
 /* *********************************** */
 yyc_key:
-	yych = *cur;
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\r':	goto yy86;
 	case ' ':	goto yy87;
@@ -595,44 +698,47 @@ yyc_key:
 	default:	goto yy84;
 	}
 yy84:
-	++cur;
-	yych = *cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy113;
 yy85:
-#line 418 "parse_pack.re"
+#line 456 "parse_pack.re"
 	{
-              len = cur - tok - 1;
-              tok++;
-              hdr_type = HDR_UNKNOWN;
-              hdr_name = substr (tok, len, 0);
+              hdr_name = tok;
+              hdr_len = cur - tok;
+              hdr_type = header_type_id (tok, hdr_len);
               goto yyc_key;
             }
-#line 611 "parse_pack.c"
+#line 713 "parse_pack.c"
 yy86:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy1125;
 	default:	goto yy113;
 	}
 yy87:
-	++cur;
-#line 232 "parse_pack.re"
-	{
-              if (hdr_name) free (hdr_name);
-              amipack_destroy (pack);
-              return NULL;
-            }
-#line 626 "parse_pack.c"
+	YYSKIP ();
+#line 277 "parse_pack.re"
+	{ goto fail; }
+#line 725 "parse_pack.c"
 yy89:
 	yyaccept = 0;
-	yych = *(marker = ++cur);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	goto yy1117;
 yy90:
-#line 239 "parse_pack.re"
-	{ tok = cur; goto yyc_value; }
-#line 634 "parse_pack.c"
+#line 280 "parse_pack.re"
+	{
+              NAMED_HEADER();
+              tok = cur;
+              goto yyc_value;
+            }
+#line 739 "parse_pack.c"
 yy91:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy1027;
@@ -653,7 +759,8 @@ yy91:
 	default:	goto yy113;
 	}
 yy92:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy996;
@@ -662,7 +769,8 @@ yy92:
 	default:	goto yy113;
 	}
 yy93:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy855;
@@ -675,7 +783,8 @@ yy93:
 	default:	goto yy113;
 	}
 yy94:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy739;
@@ -692,7 +801,8 @@ yy94:
 	default:	goto yy113;
 	}
 yy95:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy684;
@@ -703,7 +813,8 @@ yy95:
 	default:	goto yy113;
 	}
 yy96:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy659;
@@ -716,28 +827,32 @@ yy96:
 	default:	goto yy113;
 	}
 yy97:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy655;
 	default:	goto yy113;
 	}
 yy98:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy642;
 	default:	goto yy113;
 	}
 yy99:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy639;
 	default:	goto yy113;
 	}
 yy100:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy570;
@@ -748,7 +863,8 @@ yy100:
 	default:	goto yy113;
 	}
 yy101:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy520;
@@ -763,14 +879,16 @@ yy101:
 	default:	goto yy113;
 	}
 yy102:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy504;
 	default:	goto yy113;
 	}
 yy103:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'B':
 	case 'b':	goto yy449;
@@ -781,7 +899,8 @@ yy103:
 	default:	goto yy113;
 	}
 yy104:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy377;
@@ -796,21 +915,24 @@ yy104:
 	default:	goto yy113;
 	}
 yy105:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy372;
 	default:	goto yy113;
 	}
 yy106:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy309;
 	default:	goto yy113;
 	}
 yy107:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy193;
@@ -829,7 +951,8 @@ yy107:
 	default:	goto yy113;
 	}
 yy108:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy173;
@@ -838,7 +961,8 @@ yy108:
 	default:	goto yy113;
 	}
 yy109:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy146;
@@ -847,7 +971,8 @@ yy109:
 	default:	goto yy113;
 	}
 yy110:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy121;
@@ -856,15 +981,16 @@ yy110:
 	default:	goto yy113;
 	}
 yy111:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy114;
 	default:	goto yy113;
 	}
 yy112:
-	++cur;
-	yych = *cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 yy113:
 	switch (yych) {
 	case ' ':
@@ -872,53 +998,59 @@ yy113:
 	default:	goto yy112;
 	}
 yy114:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy115;
 	default:	goto yy113;
 	}
 yy115:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy116;
 	default:	goto yy113;
 	}
 yy116:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy117;
 	default:	goto yy113;
 	}
 yy117:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy118;
 	default:	goto yy113;
 	}
 yy118:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy119;
 	default:	goto yy113;
 	}
 yy119:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy120;
 	default:	goto yy112;
 	}
 yy120:
-#line 417 "parse_pack.re"
+#line 455 "parse_pack.re"
 	{ SET_HEADER(Waiting); }
-#line 920 "parse_pack.c"
+#line 1051 "parse_pack.c"
 yy121:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy134;
@@ -927,89 +1059,99 @@ yy121:
 	default:	goto yy113;
 	}
 yy122:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy123;
 	default:	goto yy113;
 	}
 yy123:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy124;
 	default:	goto yy113;
 	}
 yy124:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy125;
 	default:	goto yy113;
 	}
 yy125:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy126;
 	default:	goto yy113;
 	}
 yy126:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy127;
 	default:	goto yy113;
 	}
 yy127:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy128;
 	default:	goto yy113;
 	}
 yy128:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy129;
 	default:	goto yy113;
 	}
 yy129:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'B':
 	case 'b':	goto yy130;
 	default:	goto yy113;
 	}
 yy130:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy131;
 	default:	goto yy113;
 	}
 yy131:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'X':
 	case 'x':	goto yy132;
 	default:	goto yy113;
 	}
 yy132:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy133;
 	default:	goto yy112;
 	}
 yy133:
-#line 416 "parse_pack.re"
+#line 454 "parse_pack.re"
 	{ SET_HEADER(VoiceMailbox); }
-#line 1010 "parse_pack.c"
+#line 1152 "parse_pack.c"
 yy134:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy135;
 	case 'U':
@@ -1017,97 +1159,106 @@ yy134:
 	default:	goto yy112;
 	}
 yy135:
-#line 413 "parse_pack.re"
+#line 451 "parse_pack.re"
 	{ SET_HEADER(Val); }
-#line 1023 "parse_pack.c"
+#line 1165 "parse_pack.c"
 yy136:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy137;
 	default:	goto yy113;
 	}
 yy137:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy138;
 	default:	goto yy113;
 	}
 yy138:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'B':
 	case 'b':	goto yy139;
 	default:	goto yy113;
 	}
 yy139:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy140;
 	default:	goto yy113;
 	}
 yy140:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy141;
 	default:	goto yy113;
 	}
 yy141:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy142;
 	default:	goto yy112;
 	}
 yy142:
-#line 415 "parse_pack.re"
+#line 453 "parse_pack.re"
 	{ SET_HEADER(Variable); }
-#line 1069 "parse_pack.c"
+#line 1216 "parse_pack.c"
 yy143:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy144;
 	default:	goto yy113;
 	}
 yy144:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy145;
 	default:	goto yy112;
 	}
 yy145:
-#line 414 "parse_pack.re"
+#line 452 "parse_pack.re"
 	{ SET_HEADER(Value); }
-#line 1087 "parse_pack.c"
+#line 1235 "parse_pack.c"
 yy146:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy162;
 	default:	goto yy113;
 	}
 yy147:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy148;
 	default:	goto yy113;
 	}
 yy148:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy149;
 	default:	goto yy113;
 	}
 yy149:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy150;
 	case 'F':
@@ -1117,118 +1268,130 @@ yy149:
 	default:	goto yy112;
 	}
 yy150:
-#line 410 "parse_pack.re"
+#line 448 "parse_pack.re"
 	{ SET_HEADER(User); }
-#line 1123 "parse_pack.c"
+#line 1274 "parse_pack.c"
 yy151:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy157;
 	default:	goto yy113;
 	}
 yy152:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy153;
 	default:	goto yy113;
 	}
 yy153:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy154;
 	default:	goto yy113;
 	}
 yy154:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy155;
 	default:	goto yy113;
 	}
 yy155:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy156;
 	default:	goto yy112;
 	}
 yy156:
-#line 412 "parse_pack.re"
+#line 450 "parse_pack.re"
 	{ SET_HEADER(Username); }
-#line 1162 "parse_pack.c"
+#line 1317 "parse_pack.c"
 yy157:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy158;
 	default:	goto yy113;
 	}
 yy158:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy159;
 	default:	goto yy113;
 	}
 yy159:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy160;
 	default:	goto yy113;
 	}
 yy160:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy161;
 	default:	goto yy112;
 	}
 yy161:
-#line 411 "parse_pack.re"
+#line 449 "parse_pack.re"
 	{ SET_HEADER(UserField); }
-#line 1194 "parse_pack.c"
+#line 1352 "parse_pack.c"
 yy162:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'Q':
 	case 'q':	goto yy163;
 	default:	goto yy113;
 	}
 yy163:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy164;
 	default:	goto yy113;
 	}
 yy164:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy165;
 	default:	goto yy113;
 	}
 yy165:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy166;
 	default:	goto yy113;
 	}
 yy166:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy167;
 	default:	goto yy113;
 	}
 yy167:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy168;
 	case '1':	goto yy169;
@@ -1236,129 +1399,141 @@ yy167:
 	default:	goto yy112;
 	}
 yy168:
-#line 407 "parse_pack.re"
+#line 445 "parse_pack.re"
 	{ SET_HEADER(Uniqueid); }
-#line 1242 "parse_pack.c"
+#line 1405 "parse_pack.c"
 yy169:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy170;
 	default:	goto yy112;
 	}
 yy170:
-#line 408 "parse_pack.re"
+#line 446 "parse_pack.re"
 	{ SET_HEADER(Uniqueid1); }
-#line 1253 "parse_pack.c"
+#line 1416 "parse_pack.c"
 yy171:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy172;
 	default:	goto yy112;
 	}
 yy172:
-#line 409 "parse_pack.re"
+#line 447 "parse_pack.re"
 	{ SET_HEADER(Uniqueid2); }
-#line 1264 "parse_pack.c"
+#line 1427 "parse_pack.c"
 yy173:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy186;
 	default:	goto yy113;
 	}
 yy174:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy175;
 	default:	goto yy113;
 	}
 yy175:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy176;
 	default:	goto yy113;
 	}
 yy176:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy177;
 	default:	goto yy113;
 	}
 yy177:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'F':
 	case 'f':	goto yy178;
 	default:	goto yy113;
 	}
 yy178:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy179;
 	default:	goto yy113;
 	}
 yy179:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy180;
 	default:	goto yy113;
 	}
 yy180:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy181;
 	default:	goto yy113;
 	}
 yy181:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy182;
 	default:	goto yy113;
 	}
 yy182:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy183;
 	default:	goto yy113;
 	}
 yy183:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy184;
 	default:	goto yy113;
 	}
 yy184:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy185;
 	default:	goto yy112;
 	}
 yy185:
-#line 406 "parse_pack.re"
+#line 444 "parse_pack.re"
 	{ SET_HEADER(TransferRate); }
-#line 1352 "parse_pack.c"
+#line 1526 "parse_pack.c"
 yy186:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy187;
 	default:	goto yy113;
 	}
 yy187:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy188;
 	case 'O':
@@ -1366,131 +1541,146 @@ yy187:
 	default:	goto yy112;
 	}
 yy188:
-#line 404 "parse_pack.re"
+#line 442 "parse_pack.re"
 	{ SET_HEADER(Time); }
-#line 1372 "parse_pack.c"
+#line 1547 "parse_pack.c"
 yy189:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy190;
 	default:	goto yy113;
 	}
 yy190:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy191;
 	default:	goto yy113;
 	}
 yy191:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy192;
 	default:	goto yy112;
 	}
 yy192:
-#line 405 "parse_pack.re"
+#line 443 "parse_pack.re"
 	{ SET_HEADER(Timeout); }
-#line 1397 "parse_pack.c"
+#line 1574 "parse_pack.c"
 yy193:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy293;
 	default:	goto yy113;
 	}
 yy194:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy286;
 	default:	goto yy113;
 	}
 yy195:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy236;
 	default:	goto yy113;
 	}
 yy196:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy231;
 	default:	goto yy113;
 	}
 yy197:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy221;
 	default:	goto yy113;
 	}
 yy198:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy207;
 	default:	goto yy113;
 	}
 yy199:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'B':
 	case 'b':	goto yy200;
 	default:	goto yy113;
 	}
 yy200:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy201;
 	default:	goto yy113;
 	}
 yy201:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'V':
 	case 'v':	goto yy202;
 	default:	goto yy113;
 	}
 yy202:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy203;
 	default:	goto yy113;
 	}
 yy203:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy204;
 	default:	goto yy113;
 	}
 yy204:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy205;
 	default:	goto yy113;
 	}
 yy205:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy206;
 	default:	goto yy112;
 	}
 yy206:
-#line 403 "parse_pack.re"
+#line 441 "parse_pack.re"
 	{ SET_HEADER(SubEvent); }
-#line 1492 "parse_pack.c"
+#line 1681 "parse_pack.c"
 yy207:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy208;
@@ -1499,14 +1689,16 @@ yy207:
 	default:	goto yy113;
 	}
 yy208:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy215;
 	default:	goto yy113;
 	}
 yy209:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy210;
@@ -1515,174 +1707,191 @@ yy209:
 	default:	goto yy113;
 	}
 yy210:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy211;
 	default:	goto yy112;
 	}
 yy211:
-#line 401 "parse_pack.re"
+#line 439 "parse_pack.re"
 	{ SET_HEADER(State); }
-#line 1528 "parse_pack.c"
+#line 1720 "parse_pack.c"
 yy212:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy213;
 	default:	goto yy113;
 	}
 yy213:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy214;
 	default:	goto yy112;
 	}
 yy214:
-#line 402 "parse_pack.re"
+#line 440 "parse_pack.re"
 	{ SET_HEADER(StatusHdr); }
-#line 1546 "parse_pack.c"
+#line 1739 "parse_pack.c"
 yy215:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy216;
 	default:	goto yy113;
 	}
 yy216:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy217;
 	default:	goto yy113;
 	}
 yy217:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy218;
 	default:	goto yy113;
 	}
 yy218:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy219;
 	default:	goto yy113;
 	}
 yy219:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy220;
 	default:	goto yy112;
 	}
 yy220:
-#line 400 "parse_pack.re"
+#line 438 "parse_pack.re"
 	{ SET_HEADER(StartTime); }
-#line 1585 "parse_pack.c"
+#line 1782 "parse_pack.c"
 yy221:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy222;
 	default:	goto yy113;
 	}
 yy222:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy223;
 	default:	goto yy113;
 	}
 yy223:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy224;
 	default:	goto yy113;
 	}
 yy224:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'Q':
 	case 'q':	goto yy225;
 	default:	goto yy113;
 	}
 yy225:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy226;
 	default:	goto yy113;
 	}
 yy226:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy227;
 	default:	goto yy113;
 	}
 yy227:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy228;
 	default:	goto yy113;
 	}
 yy228:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy229;
 	default:	goto yy113;
 	}
 yy229:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy230;
 	default:	goto yy112;
 	}
 yy230:
-#line 399 "parse_pack.re"
+#line 437 "parse_pack.re"
 	{ SET_HEADER(SrcUniqueID); }
-#line 1652 "parse_pack.c"
+#line 1857 "parse_pack.c"
 yy231:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy232;
 	default:	goto yy113;
 	}
 yy232:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy233;
 	default:	goto yy113;
 	}
 yy233:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy234;
 	default:	goto yy113;
 	}
 yy234:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy235;
 	default:	goto yy112;
 	}
 yy235:
-#line 398 "parse_pack.re"
+#line 436 "parse_pack.re"
 	{ SET_HEADER(Source); }
-#line 1684 "parse_pack.c"
+#line 1892 "parse_pack.c"
 yy236:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '-':	goto yy237;
 	case 'L':
@@ -1690,7 +1899,8 @@ yy236:
 	default:	goto yy113;
 	}
 yy237:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy246;
@@ -1701,162 +1911,182 @@ yy237:
 	default:	goto yy113;
 	}
 yy238:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy239;
 	default:	goto yy113;
 	}
 yy239:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy240;
 	default:	goto yy113;
 	}
 yy240:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy241;
 	default:	goto yy113;
 	}
 yy241:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy242;
 	default:	goto yy113;
 	}
 yy242:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy243;
 	default:	goto yy113;
 	}
 yy243:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy244;
 	default:	goto yy113;
 	}
 yy244:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy245;
 	default:	goto yy112;
 	}
 yy245:
-#line 396 "parse_pack.re"
+#line 434 "parse_pack.re"
 	{ SET_HEADER(SIPLastMsg); }
-#line 1756 "parse_pack.c"
+#line 1972 "parse_pack.c"
 yy246:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy274;
 	default:	goto yy113;
 	}
 yy247:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy259;
 	default:	goto yy113;
 	}
 yy248:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy249;
 	default:	goto yy113;
 	}
 yy249:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy250;
 	default:	goto yy113;
 	}
 yy250:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy251;
 	default:	goto yy113;
 	}
 yy251:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy252;
 	default:	goto yy113;
 	}
 yy252:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy253;
 	default:	goto yy113;
 	}
 yy253:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy254;
 	default:	goto yy113;
 	}
 yy254:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy255;
 	default:	goto yy113;
 	}
 yy255:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy256;
 	default:	goto yy113;
 	}
 yy256:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy257;
 	default:	goto yy113;
 	}
 yy257:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy258;
 	default:	goto yy112;
 	}
 yy258:
-#line 397 "parse_pack.re"
+#line 435 "parse_pack.re"
 	{ SET_HEADER(SIP_NatSupport); }
-#line 1844 "parse_pack.c"
+#line 2071 "parse_pack.c"
 yy259:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy260;
 	default:	goto yy113;
 	}
 yy260:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy261;
 	default:	goto yy113;
 	}
 yy261:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy262;
@@ -1865,212 +2095,236 @@ yy261:
 	default:	goto yy113;
 	}
 yy262:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy268;
 	default:	goto yy113;
 	}
 yy263:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy264;
 	default:	goto yy113;
 	}
 yy264:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy265;
 	default:	goto yy113;
 	}
 yy265:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy266;
 	default:	goto yy113;
 	}
 yy266:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy267;
 	default:	goto yy112;
 	}
 yy267:
-#line 395 "parse_pack.re"
+#line 433 "parse_pack.re"
 	{ SET_HEADER(SIP_FromUser); }
-#line 1906 "parse_pack.c"
+#line 2140 "parse_pack.c"
 yy268:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy269;
 	default:	goto yy113;
 	}
 yy269:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy270;
 	default:	goto yy113;
 	}
 yy270:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy271;
 	default:	goto yy113;
 	}
 yy271:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy272;
 	default:	goto yy113;
 	}
 yy272:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy273;
 	default:	goto yy112;
 	}
 yy273:
-#line 394 "parse_pack.re"
+#line 432 "parse_pack.re"
 	{ SET_HEADER(SIP_FromDomain); }
-#line 1945 "parse_pack.c"
+#line 2183 "parse_pack.c"
 yy274:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy275;
 	default:	goto yy113;
 	}
 yy275:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'H':
 	case 'h':	goto yy276;
 	default:	goto yy113;
 	}
 yy276:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy277;
 	default:	goto yy113;
 	}
 yy277:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy278;
 	default:	goto yy113;
 	}
 yy278:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy279;
 	default:	goto yy113;
 	}
 yy279:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy280;
 	default:	goto yy113;
 	}
 yy280:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy281;
 	default:	goto yy113;
 	}
 yy281:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy282;
 	default:	goto yy113;
 	}
 yy282:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy283;
 	default:	goto yy113;
 	}
 yy283:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy284;
 	default:	goto yy113;
 	}
 yy284:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy285;
 	default:	goto yy112;
 	}
 yy285:
-#line 393 "parse_pack.re"
+#line 431 "parse_pack.re"
 	{ SET_HEADER(SIP_AuthInsecure); }
-#line 2026 "parse_pack.c"
+#line 2274 "parse_pack.c"
 yy286:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy287;
 	default:	goto yy113;
 	}
 yy287:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy288;
 	default:	goto yy113;
 	}
 yy288:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy289;
 	default:	goto yy113;
 	}
 yy289:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'W':
 	case 'w':	goto yy290;
 	default:	goto yy113;
 	}
 yy290:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy291;
 	default:	goto yy113;
 	}
 yy291:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy292;
 	default:	goto yy112;
 	}
 yy292:
-#line 392 "parse_pack.re"
+#line 430 "parse_pack.re"
 	{ SET_HEADER(ShutdownHdr); }
-#line 2072 "parse_pack.c"
+#line 2325 "parse_pack.c"
 yy293:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy294;
@@ -2079,29 +2333,32 @@ yy293:
 	default:	goto yy113;
 	}
 yy294:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy305;
 	default:	goto yy113;
 	}
 yy295:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy296;
 	default:	goto yy113;
 	}
 yy296:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy297;
 	default:	goto yy113;
 	}
 yy297:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy298;
 	case 'E':
@@ -2109,75 +2366,82 @@ yy297:
 	default:	goto yy112;
 	}
 yy298:
-#line 390 "parse_pack.re"
+#line 428 "parse_pack.re"
 	{ SET_HEADER(Secret); }
-#line 2115 "parse_pack.c"
+#line 2372 "parse_pack.c"
 yy299:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'X':
 	case 'x':	goto yy300;
 	default:	goto yy113;
 	}
 yy300:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy301;
 	default:	goto yy113;
 	}
 yy301:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy302;
 	default:	goto yy113;
 	}
 yy302:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy303;
 	default:	goto yy113;
 	}
 yy303:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy304;
 	default:	goto yy112;
 	}
 yy304:
-#line 391 "parse_pack.re"
+#line 429 "parse_pack.re"
 	{ SET_HEADER(SecretExist); }
-#line 2154 "parse_pack.c"
+#line 2415 "parse_pack.c"
 yy305:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy306;
 	default:	goto yy113;
 	}
 yy306:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy307;
 	default:	goto yy113;
 	}
 yy307:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy308;
 	default:	goto yy112;
 	}
 yy308:
-#line 389 "parse_pack.re"
+#line 427 "parse_pack.re"
 	{ SET_HEADER(Seconds); }
-#line 2179 "parse_pack.c"
+#line 2442 "parse_pack.c"
 yy309:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy311;
@@ -2190,7 +2454,8 @@ yy309:
 	default:	goto yy113;
 	}
 yy310:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy340;
@@ -2201,144 +2466,163 @@ yy310:
 	default:	goto yy113;
 	}
 yy311:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy336;
 	default:	goto yy113;
 	}
 yy312:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy327;
 	default:	goto yy113;
 	}
 yy313:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy314;
 	default:	goto yy113;
 	}
 yy314:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy315;
 	default:	goto yy113;
 	}
 yy315:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy316;
 	default:	goto yy113;
 	}
 yy316:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy317;
 	default:	goto yy113;
 	}
 yy317:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy318;
 	default:	goto yy113;
 	}
 yy318:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy319;
 	default:	goto yy113;
 	}
 yy319:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy320;
 	default:	goto yy113;
 	}
 yy320:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy321;
 	default:	goto yy113;
 	}
 yy321:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy322;
 	default:	goto yy113;
 	}
 yy322:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy323;
 	default:	goto yy113;
 	}
 yy323:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy324;
 	default:	goto yy113;
 	}
 yy324:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy325;
 	default:	goto yy113;
 	}
 yy325:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy326;
 	default:	goto yy112;
 	}
 yy326:
-#line 386 "parse_pack.re"
+#line 424 "parse_pack.re"
 	{ SET_HEADER(RemoteStationID); }
-#line 2312 "parse_pack.c"
+#line 2591 "parse_pack.c"
 yy327:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'X':
 	case 'x':	goto yy328;
 	default:	goto yy113;
 	}
 yy328:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy329;
 	default:	goto yy113;
 	}
 yy329:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy330;
 	default:	goto yy113;
 	}
 yy330:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy331;
 	default:	goto yy113;
 	}
 yy331:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy332;
@@ -2347,114 +2631,124 @@ yy331:
 	default:	goto yy113;
 	}
 yy332:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy333;
 	default:	goto yy112;
 	}
 yy333:
-#line 384 "parse_pack.re"
+#line 422 "parse_pack.re"
 	{ SET_HEADER(RegExpire); }
-#line 2360 "parse_pack.c"
+#line 2644 "parse_pack.c"
 yy334:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy335;
 	default:	goto yy112;
 	}
 yy335:
-#line 385 "parse_pack.re"
+#line 423 "parse_pack.re"
 	{ SET_HEADER(RegExpiry); }
-#line 2371 "parse_pack.c"
+#line 2655 "parse_pack.c"
 yy336:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy337;
 	default:	goto yy113;
 	}
 yy337:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy338;
 	default:	goto yy113;
 	}
 yy338:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy339;
 	default:	goto yy112;
 	}
 yy339:
-#line 383 "parse_pack.re"
+#line 421 "parse_pack.re"
 	{ SET_HEADER(Reason); }
-#line 2396 "parse_pack.c"
+#line 2682 "parse_pack.c"
 yy340:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy365;
 	default:	goto yy113;
 	}
 yy341:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy347;
 	default:	goto yy113;
 	}
 yy342:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy343;
 	default:	goto yy113;
 	}
 yy343:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy344;
 	default:	goto yy113;
 	}
 yy344:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy345;
 	default:	goto yy113;
 	}
 yy345:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy346;
 	default:	goto yy112;
 	}
 yy346:
-#line 388 "parse_pack.re"
+#line 426 "parse_pack.re"
 	{ SET_HEADER(Restart); }
-#line 2442 "parse_pack.c"
+#line 2733 "parse_pack.c"
 yy347:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy348;
 	default:	goto yy113;
 	}
 yy348:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy349;
 	default:	goto yy113;
 	}
 yy349:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy350;
@@ -2462,22 +2756,24 @@ yy349:
 	}
 yy350:
 	yyaccept = 1;
-	yych = *(marker = ++cur);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case ' ':	goto yy351;
 	case ':':	goto yy352;
 	default:	goto yy112;
 	}
 yy351:
-#line 266 "parse_pack.re"
+#line 304 "parse_pack.re"
 	{
               amipack_type (pack, AMI_RESPONSE);
               SET_HEADER(Response);
             }
-#line 2478 "parse_pack.c"
+#line 2774 "parse_pack.c"
 yy352:
-	++cur;
-	yych = *cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case ' ':	goto yy352;
 	case 'F':
@@ -2485,157 +2781,174 @@ yy352:
 	default:	goto yy354;
 	}
 yy354:
-	cur = marker;
+	YYRESTORE ();
 	if (yyaccept == 0) {
 		goto yy90;
 	} else {
 		goto yy351;
 	}
 yy355:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy356;
 	default:	goto yy354;
 	}
 yy356:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy357;
 	default:	goto yy354;
 	}
 yy357:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy358;
 	default:	goto yy354;
 	}
 yy358:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy359;
 	default:	goto yy354;
 	}
 yy359:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'W':
 	case 'w':	goto yy360;
 	default:	goto yy354;
 	}
 yy360:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy361;
 	default:	goto yy354;
 	}
 yy361:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\r':	goto yy362;
 	default:	goto yy354;
 	}
 yy362:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy363;
 	default:	goto yy354;
 	}
 yy363:
-	++cur;
-#line 259 "parse_pack.re"
+	YYSKIP ();
+#line 297 "parse_pack.re"
 	{
               len = cur - tok;
               tok = cur;
               amipack_type (pack, AMI_RESPONSE);
-              amipack_append (pack, Response, "Follows");
+              APPEND_HEADER(Response, NULL, 0, "Follows", 7);
               goto yyc_command;
             }
-#line 2559 "parse_pack.c"
+#line 2863 "parse_pack.c"
 yy365:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy366;
 	default:	goto yy113;
 	}
 yy366:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy367;
 	default:	goto yy113;
 	}
 yy367:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy368;
 	default:	goto yy113;
 	}
 yy368:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy369;
 	default:	goto yy113;
 	}
 yy369:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy370;
 	default:	goto yy113;
 	}
 yy370:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy371;
 	default:	goto yy112;
 	}
 yy371:
-#line 387 "parse_pack.re"
+#line 425 "parse_pack.re"
 	{ SET_HEADER(Resolution); }
-#line 2605 "parse_pack.c"
+#line 2914 "parse_pack.c"
 yy372:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy373;
 	default:	goto yy113;
 	}
 yy373:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy374;
 	default:	goto yy113;
 	}
 yy374:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy375;
 	default:	goto yy113;
 	}
 yy375:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy376;
 	default:	goto yy112;
 	}
 yy376:
-#line 382 "parse_pack.re"
+#line 420 "parse_pack.re"
 	{ SET_HEADER(Queue); }
-#line 2637 "parse_pack.c"
+#line 2949 "parse_pack.c"
 yy377:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy429;
@@ -2644,7 +2957,8 @@ yy377:
 	default:	goto yy113;
 	}
 yy378:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy413;
@@ -2653,28 +2967,32 @@ yy378:
 	default:	goto yy113;
 	}
 yy379:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy403;
 	default:	goto yy113;
 	}
 yy380:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy396;
 	default:	goto yy113;
 	}
 yy381:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy382;
 	default:	goto yy113;
 	}
 yy382:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy383;
@@ -2683,252 +3001,279 @@ yy382:
 	default:	goto yy113;
 	}
 yy383:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy391;
 	default:	goto yy113;
 	}
 yy384:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy385;
 	default:	goto yy113;
 	}
 yy385:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy386;
 	default:	goto yy113;
 	}
 yy386:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy387;
 	default:	goto yy113;
 	}
 yy387:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy388;
 	default:	goto yy113;
 	}
 yy388:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy389;
 	default:	goto yy113;
 	}
 yy389:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy390;
 	default:	goto yy112;
 	}
 yy390:
-#line 381 "parse_pack.re"
+#line 419 "parse_pack.re"
 	{ SET_HEADER(Privilege); }
-#line 2738 "parse_pack.c"
+#line 3062 "parse_pack.c"
 yy391:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy392;
 	default:	goto yy113;
 	}
 yy392:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy393;
 	default:	goto yy113;
 	}
 yy393:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'Y':
 	case 'y':	goto yy394;
 	default:	goto yy113;
 	}
 yy394:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy395;
 	default:	goto yy112;
 	}
 yy395:
-#line 380 "parse_pack.re"
+#line 418 "parse_pack.re"
 	{ SET_HEADER(Priority); }
-#line 2770 "parse_pack.c"
+#line 3097 "parse_pack.c"
 yy396:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy397;
 	default:	goto yy113;
 	}
 yy397:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy398;
 	default:	goto yy113;
 	}
 yy398:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy399;
 	default:	goto yy113;
 	}
 yy399:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy400;
 	default:	goto yy113;
 	}
 yy400:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy401;
 	default:	goto yy113;
 	}
 yy401:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy402;
 	default:	goto yy112;
 	}
 yy402:
-#line 379 "parse_pack.re"
+#line 417 "parse_pack.re"
 	{ SET_HEADER(Position); }
-#line 2816 "parse_pack.c"
+#line 3148 "parse_pack.c"
 yy403:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'K':
 	case 'k':	goto yy404;
 	default:	goto yy113;
 	}
 yy404:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy405;
 	default:	goto yy113;
 	}
 yy405:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy406;
 	default:	goto yy113;
 	}
 yy406:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy407;
 	default:	goto yy113;
 	}
 yy407:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy408;
 	default:	goto yy113;
 	}
 yy408:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy409;
 	default:	goto yy113;
 	}
 yy409:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy410;
 	default:	goto yy113;
 	}
 yy410:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy411;
 	default:	goto yy113;
 	}
 yy411:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy412;
 	default:	goto yy112;
 	}
 yy412:
-#line 378 "parse_pack.re"
+#line 416 "parse_pack.re"
 	{ SET_HEADER(Pickupgroup); }
-#line 2883 "parse_pack.c"
+#line 3223 "parse_pack.c"
 yy413:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy420;
 	default:	goto yy113;
 	}
 yy414:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy415;
 	default:	goto yy113;
 	}
 yy415:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy416;
 	default:	goto yy113;
 	}
 yy416:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy417;
 	default:	goto yy113;
 	}
 yy417:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'Y':
 	case 'y':	goto yy418;
 	default:	goto yy113;
 	}
 yy418:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy419;
 	default:	goto yy112;
 	}
 yy419:
-#line 377 "parse_pack.re"
+#line 415 "parse_pack.re"
 	{ SET_HEADER(Penalty); }
-#line 2929 "parse_pack.c"
+#line 3274 "parse_pack.c"
 yy420:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy421;
 	case 'S':
@@ -2936,212 +3281,237 @@ yy420:
 	default:	goto yy112;
 	}
 yy421:
-#line 375 "parse_pack.re"
+#line 413 "parse_pack.re"
 	{ SET_HEADER(Peer); }
-#line 2942 "parse_pack.c"
+#line 3287 "parse_pack.c"
 yy422:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy423;
 	default:	goto yy113;
 	}
 yy423:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy424;
 	default:	goto yy113;
 	}
 yy424:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy425;
 	default:	goto yy113;
 	}
 yy425:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy426;
 	default:	goto yy113;
 	}
 yy426:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy427;
 	default:	goto yy113;
 	}
 yy427:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy428;
 	default:	goto yy112;
 	}
 yy428:
-#line 376 "parse_pack.re"
+#line 414 "parse_pack.re"
 	{ SET_HEADER(PeerStatusHdr); }
-#line 2988 "parse_pack.c"
+#line 3338 "parse_pack.c"
 yy429:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy435;
 	default:	goto yy113;
 	}
 yy430:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy431;
 	default:	goto yy113;
 	}
 yy431:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy432;
 	default:	goto yy113;
 	}
 yy432:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy433;
 	default:	goto yy113;
 	}
 yy433:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy434;
 	default:	goto yy112;
 	}
 yy434:
-#line 374 "parse_pack.re"
+#line 412 "parse_pack.re"
 	{ SET_HEADER(Paused); }
-#line 3027 "parse_pack.c"
+#line 3381 "parse_pack.c"
 yy435:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy436;
 	default:	goto yy113;
 	}
 yy436:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy437;
 	default:	goto yy113;
 	}
 yy437:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy438;
 	default:	goto yy113;
 	}
 yy438:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy439;
 	default:	goto yy113;
 	}
 yy439:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy440;
 	default:	goto yy113;
 	}
 yy440:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy441;
 	default:	goto yy113;
 	}
 yy441:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'F':
 	case 'f':	goto yy442;
 	default:	goto yy113;
 	}
 yy442:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy443;
 	default:	goto yy113;
 	}
 yy443:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy444;
 	default:	goto yy113;
 	}
 yy444:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy445;
 	default:	goto yy113;
 	}
 yy445:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy446;
 	default:	goto yy113;
 	}
 yy446:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy447;
 	default:	goto yy113;
 	}
 yy447:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy448;
 	default:	goto yy112;
 	}
 yy448:
-#line 373 "parse_pack.re"
+#line 411 "parse_pack.re"
 	{ SET_HEADER(PagesTransferred); }
-#line 3122 "parse_pack.c"
+#line 3488 "parse_pack.c"
 yy449:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'J':
 	case 'j':	goto yy495;
 	default:	goto yy113;
 	}
 yy450:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy468;
 	default:	goto yy113;
 	}
 yy451:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy452;
 	default:	goto yy113;
 	}
 yy452:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy453;
@@ -3150,106 +3520,118 @@ yy452:
 	default:	goto yy113;
 	}
 yy453:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy458;
 	default:	goto yy113;
 	}
 yy454:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy455;
 	default:	goto yy113;
 	}
 yy455:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy456;
 	default:	goto yy113;
 	}
 yy456:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy457;
 	default:	goto yy112;
 	}
 yy457:
-#line 372 "parse_pack.re"
+#line 410 "parse_pack.re"
 	{ SET_HEADER(Output); }
-#line 3184 "parse_pack.c"
+#line 3557 "parse_pack.c"
 yy458:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy459;
 	default:	goto yy113;
 	}
 yy459:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy460;
 	default:	goto yy113;
 	}
 yy460:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy461;
 	default:	goto yy113;
 	}
 yy461:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy462;
 	default:	goto yy113;
 	}
 yy462:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy463;
 	default:	goto yy113;
 	}
 yy463:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy464;
 	default:	goto yy113;
 	}
 yy464:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy465;
 	default:	goto yy113;
 	}
 yy465:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy466;
 	default:	goto yy113;
 	}
 yy466:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy467;
 	default:	goto yy112;
 	}
 yy467:
-#line 371 "parse_pack.re"
+#line 409 "parse_pack.re"
 	{ SET_HEADER(Outgoinglimit); }
-#line 3251 "parse_pack.c"
+#line 3632 "parse_pack.c"
 yy468:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy469;
@@ -3260,247 +3642,276 @@ yy468:
 	default:	goto yy113;
 	}
 yy469:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy484;
 	default:	goto yy113;
 	}
 yy470:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy476;
 	default:	goto yy113;
 	}
 yy471:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy472;
 	default:	goto yy113;
 	}
 yy472:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy473;
 	default:	goto yy113;
 	}
 yy473:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy474;
 	default:	goto yy113;
 	}
 yy474:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy475;
 	default:	goto yy112;
 	}
 yy475:
-#line 370 "parse_pack.re"
+#line 408 "parse_pack.re"
 	{ SET_HEADER(OldName); }
-#line 3308 "parse_pack.c"
+#line 3695 "parse_pack.c"
 yy476:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy477;
 	default:	goto yy113;
 	}
 yy477:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy478;
 	default:	goto yy113;
 	}
 yy478:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy479;
 	default:	goto yy113;
 	}
 yy479:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy480;
 	default:	goto yy113;
 	}
 yy480:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy481;
 	default:	goto yy113;
 	}
 yy481:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy482;
 	default:	goto yy113;
 	}
 yy482:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy483;
 	default:	goto yy112;
 	}
 yy483:
-#line 369 "parse_pack.re"
+#line 407 "parse_pack.re"
 	{ SET_HEADER(OldMessages); }
-#line 3361 "parse_pack.c"
+#line 3754 "parse_pack.c"
 yy484:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy485;
 	default:	goto yy113;
 	}
 yy485:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy486;
 	default:	goto yy113;
 	}
 yy486:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy487;
 	default:	goto yy113;
 	}
 yy487:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy488;
 	default:	goto yy113;
 	}
 yy488:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy489;
 	default:	goto yy113;
 	}
 yy489:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy490;
 	default:	goto yy113;
 	}
 yy490:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy491;
 	default:	goto yy113;
 	}
 yy491:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy492;
 	default:	goto yy113;
 	}
 yy492:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy493;
 	default:	goto yy113;
 	}
 yy493:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy494;
 	default:	goto yy112;
 	}
 yy494:
-#line 368 "parse_pack.re"
+#line 406 "parse_pack.re"
 	{ SET_HEADER(OldAccountCode); }
-#line 3435 "parse_pack.c"
+#line 3837 "parse_pack.c"
 yy495:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy496;
 	default:	goto yy113;
 	}
 yy496:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy497;
 	default:	goto yy113;
 	}
 yy497:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy498;
 	default:	goto yy113;
 	}
 yy498:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy499;
 	default:	goto yy113;
 	}
 yy499:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy500;
 	default:	goto yy113;
 	}
 yy500:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy501;
 	default:	goto yy113;
 	}
 yy501:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy502;
 	default:	goto yy113;
 	}
 yy502:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy503;
 	default:	goto yy112;
 	}
 yy503:
-#line 367 "parse_pack.re"
+#line 405 "parse_pack.re"
 	{ SET_HEADER(ObjectName); }
-#line 3495 "parse_pack.c"
+#line 3904 "parse_pack.c"
 yy504:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'W':
 	case 'w':	goto yy505;
 	default:	goto yy113;
 	}
 yy505:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy506;
@@ -3509,112 +3920,125 @@ yy505:
 	default:	goto yy113;
 	}
 yy506:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy512;
 	default:	goto yy113;
 	}
 yy507:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy508;
 	default:	goto yy113;
 	}
 yy508:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy509;
 	default:	goto yy113;
 	}
 yy509:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy510;
 	default:	goto yy113;
 	}
 yy510:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy511;
 	default:	goto yy112;
 	}
 yy511:
-#line 366 "parse_pack.re"
+#line 404 "parse_pack.re"
 	{ SET_HEADER(Newname); }
-#line 3550 "parse_pack.c"
+#line 3965 "parse_pack.c"
 yy512:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy513;
 	default:	goto yy113;
 	}
 yy513:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy514;
 	default:	goto yy113;
 	}
 yy514:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy515;
 	default:	goto yy113;
 	}
 yy515:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy516;
 	default:	goto yy113;
 	}
 yy516:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy517;
 	default:	goto yy113;
 	}
 yy517:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy518;
 	default:	goto yy113;
 	}
 yy518:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy519;
 	default:	goto yy112;
 	}
 yy519:
-#line 365 "parse_pack.re"
+#line 403 "parse_pack.re"
 	{ SET_HEADER(NewMessages); }
-#line 3603 "parse_pack.c"
+#line 4024 "parse_pack.c"
 yy520:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy564;
 	default:	goto yy113;
 	}
 yy521:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '5':	goto yy551;
 	default:	goto yy113;
 	}
 yy522:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy536;
@@ -3623,325 +4047,362 @@ yy522:
 	default:	goto yy113;
 	}
 yy523:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'X':
 	case 'x':	goto yy534;
 	default:	goto yy113;
 	}
 yy524:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'H':
 	case 'h':	goto yy525;
 	default:	goto yy113;
 	}
 yy525:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy526;
 	default:	goto yy113;
 	}
 yy526:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy527;
 	default:	goto yy113;
 	}
 yy527:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy528;
 	default:	goto yy113;
 	}
 yy528:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy529;
 	default:	goto yy113;
 	}
 yy529:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy530;
 	default:	goto yy113;
 	}
 yy530:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy531;
 	default:	goto yy113;
 	}
 yy531:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy532;
 	default:	goto yy113;
 	}
 yy532:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy533;
 	default:	goto yy112;
 	}
 yy533:
-#line 364 "parse_pack.re"
+#line 402 "parse_pack.re"
 	{ SET_HEADER(MOHSuggest); }
-#line 3699 "parse_pack.c"
+#line 4132 "parse_pack.c"
 yy534:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy535;
 	default:	goto yy112;
 	}
 yy535:
-#line 363 "parse_pack.re"
+#line 401 "parse_pack.re"
 	{ SET_HEADER(Mix); }
-#line 3710 "parse_pack.c"
+#line 4143 "parse_pack.c"
 yy536:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'B':
 	case 'b':	goto yy543;
 	default:	goto yy113;
 	}
 yy537:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy538;
 	default:	goto yy113;
 	}
 yy538:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy539;
 	default:	goto yy113;
 	}
 yy539:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy540;
 	default:	goto yy113;
 	}
 yy540:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy541;
 	default:	goto yy113;
 	}
 yy541:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy542;
 	default:	goto yy112;
 	}
 yy542:
-#line 362 "parse_pack.re"
+#line 400 "parse_pack.re"
 	{ SET_HEADER(Message); }
-#line 3756 "parse_pack.c"
+#line 4194 "parse_pack.c"
 yy543:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy544;
 	default:	goto yy113;
 	}
 yy544:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy545;
 	default:	goto yy113;
 	}
 yy545:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy546;
 	default:	goto yy113;
 	}
 yy546:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'H':
 	case 'h':	goto yy547;
 	default:	goto yy113;
 	}
 yy547:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy548;
 	default:	goto yy113;
 	}
 yy548:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy549;
 	default:	goto yy113;
 	}
 yy549:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy550;
 	default:	goto yy112;
 	}
 yy550:
-#line 361 "parse_pack.re"
+#line 399 "parse_pack.re"
 	{ SET_HEADER(Membership); }
-#line 3809 "parse_pack.c"
+#line 4253 "parse_pack.c"
 yy551:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy552;
 	default:	goto yy113;
 	}
 yy552:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy553;
 	default:	goto yy113;
 	}
 yy553:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy554;
 	default:	goto yy113;
 	}
 yy554:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy555;
 	default:	goto yy113;
 	}
 yy555:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy556;
 	default:	goto yy113;
 	}
 yy556:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy557;
 	default:	goto yy113;
 	}
 yy557:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy558;
 	default:	goto yy113;
 	}
 yy558:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'X':
 	case 'x':	goto yy559;
 	default:	goto yy113;
 	}
 yy559:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy560;
 	default:	goto yy113;
 	}
 yy560:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy561;
 	default:	goto yy113;
 	}
 yy561:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy562;
 	default:	goto yy113;
 	}
 yy562:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy563;
 	default:	goto yy112;
 	}
 yy563:
-#line 360 "parse_pack.re"
+#line 398 "parse_pack.re"
 	{ SET_HEADER(MD5SecretExist); }
-#line 3897 "parse_pack.c"
+#line 4352 "parse_pack.c"
 yy564:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy565;
 	default:	goto yy113;
 	}
 yy565:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'B':
 	case 'b':	goto yy566;
 	default:	goto yy113;
 	}
 yy566:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy567;
 	default:	goto yy113;
 	}
 yy567:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'X':
 	case 'x':	goto yy568;
 	default:	goto yy113;
 	}
 yy568:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy569;
 	default:	goto yy112;
 	}
 yy569:
-#line 359 "parse_pack.re"
+#line 397 "parse_pack.re"
 	{ SET_HEADER(Mailbox); }
-#line 3936 "parse_pack.c"
+#line 4395 "parse_pack.c"
 yy570:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy615;
 	default:	goto yy113;
 	}
 yy571:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy604;
@@ -3950,7 +4411,8 @@ yy571:
 	default:	goto yy113;
 	}
 yy572:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy573;
@@ -3959,28 +4421,32 @@ yy572:
 	default:	goto yy113;
 	}
 yy573:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy587;
 	default:	goto yy113;
 	}
 yy574:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy575;
 	default:	goto yy113;
 	}
 yy575:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy576;
 	default:	goto yy113;
 	}
 yy576:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy577;
@@ -3989,71 +4455,78 @@ yy576:
 	default:	goto yy113;
 	}
 yy577:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'H':
 	case 'h':	goto yy583;
 	default:	goto yy113;
 	}
 yy578:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy579;
 	default:	goto yy113;
 	}
 yy579:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy580;
 	default:	goto yy113;
 	}
 yy580:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy581;
 	default:	goto yy113;
 	}
 yy581:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy582;
 	default:	goto yy112;
 	}
 yy582:
-#line 358 "parse_pack.re"
+#line 396 "parse_pack.re"
 	{ SET_HEADER(Logintime); }
-#line 4030 "parse_pack.c"
+#line 4500 "parse_pack.c"
 yy583:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy584;
 	default:	goto yy113;
 	}
 yy584:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy585;
 	default:	goto yy113;
 	}
 yy585:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy586;
 	default:	goto yy112;
 	}
 yy586:
-#line 357 "parse_pack.re"
+#line 395 "parse_pack.re"
 	{ SET_HEADER(Loginchan); }
-#line 4055 "parse_pack.c"
+#line 4527 "parse_pack.c"
 yy587:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy588;
@@ -4062,191 +4535,212 @@ yy587:
 	default:	goto yy113;
 	}
 yy588:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy594;
 	default:	goto yy113;
 	}
 yy589:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy590;
 	default:	goto yy113;
 	}
 yy590:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy591;
 	default:	goto yy113;
 	}
 yy591:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy592;
 	default:	goto yy113;
 	}
 yy592:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy593;
 	default:	goto yy112;
 	}
 yy593:
-#line 356 "parse_pack.re"
+#line 394 "parse_pack.re"
 	{ SET_HEADER(Location); }
-#line 4103 "parse_pack.c"
+#line 4580 "parse_pack.c"
 yy594:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy595;
 	default:	goto yy113;
 	}
 yy595:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy596;
 	default:	goto yy113;
 	}
 yy596:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy597;
 	default:	goto yy113;
 	}
 yy597:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy598;
 	default:	goto yy113;
 	}
 yy598:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy599;
 	default:	goto yy113;
 	}
 yy599:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy600;
 	default:	goto yy113;
 	}
 yy600:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy601;
 	default:	goto yy113;
 	}
 yy601:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy602;
 	default:	goto yy113;
 	}
 yy602:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy603;
 	default:	goto yy112;
 	}
 yy603:
-#line 355 "parse_pack.re"
+#line 393 "parse_pack.re"
 	{ SET_HEADER(LocalStationID); }
-#line 4170 "parse_pack.c"
+#line 4655 "parse_pack.c"
 yy604:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'K':
 	case 'k':	goto yy613;
 	default:	goto yy113;
 	}
 yy605:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy606;
 	default:	goto yy113;
 	}
 yy606:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy607;
 	default:	goto yy113;
 	}
 yy607:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy608;
 	default:	goto yy113;
 	}
 yy608:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy609;
 	default:	goto yy113;
 	}
 yy609:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy610;
 	default:	goto yy113;
 	}
 yy610:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy611;
 	default:	goto yy113;
 	}
 yy611:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy612;
 	default:	goto yy112;
 	}
 yy612:
-#line 354 "parse_pack.re"
+#line 392 "parse_pack.re"
 	{ SET_HEADER(ListItems); }
-#line 4230 "parse_pack.c"
+#line 4722 "parse_pack.c"
 yy613:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy614;
 	default:	goto yy112;
 	}
 yy614:
-#line 353 "parse_pack.re"
+#line 391 "parse_pack.re"
 	{ SET_HEADER(Link); }
-#line 4241 "parse_pack.c"
+#line 4733 "parse_pack.c"
 yy615:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy616;
 	default:	goto yy113;
 	}
 yy616:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy617;
@@ -4257,369 +4751,408 @@ yy616:
 	default:	goto yy113;
 	}
 yy617:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy628;
 	default:	goto yy113;
 	}
 yy618:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy624;
 	default:	goto yy113;
 	}
 yy619:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy620;
 	default:	goto yy113;
 	}
 yy620:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy621;
 	default:	goto yy113;
 	}
 yy621:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy622;
 	default:	goto yy113;
 	}
 yy622:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy623;
 	default:	goto yy112;
 	}
 yy623:
-#line 352 "parse_pack.re"
+#line 390 "parse_pack.re"
 	{ SET_HEADER(LastData); }
-#line 4305 "parse_pack.c"
+#line 4804 "parse_pack.c"
 yy624:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy625;
 	default:	goto yy113;
 	}
 yy625:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy626;
 	default:	goto yy113;
 	}
 yy626:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy627;
 	default:	goto yy112;
 	}
 yy627:
-#line 351 "parse_pack.re"
+#line 389 "parse_pack.re"
 	{ SET_HEADER(LastCall); }
-#line 4330 "parse_pack.c"
+#line 4831 "parse_pack.c"
 yy628:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy629;
 	default:	goto yy113;
 	}
 yy629:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy630;
 	default:	goto yy113;
 	}
 yy630:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy631;
 	default:	goto yy113;
 	}
 yy631:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy632;
 	default:	goto yy113;
 	}
 yy632:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy633;
 	default:	goto yy113;
 	}
 yy633:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy634;
 	default:	goto yy113;
 	}
 yy634:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy635;
 	default:	goto yy113;
 	}
 yy635:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy636;
 	default:	goto yy113;
 	}
 yy636:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy637;
 	default:	goto yy113;
 	}
 yy637:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy638;
 	default:	goto yy112;
 	}
 yy638:
-#line 350 "parse_pack.re"
+#line 388 "parse_pack.re"
 	{ SET_HEADER(LastApplication); }
-#line 4404 "parse_pack.c"
+#line 4914 "parse_pack.c"
 yy639:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'Y':
 	case 'y':	goto yy640;
 	default:	goto yy113;
 	}
 yy640:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy641;
 	default:	goto yy112;
 	}
 yy641:
-#line 349 "parse_pack.re"
+#line 387 "parse_pack.re"
 	{ SET_HEADER(Key); }
-#line 4422 "parse_pack.c"
+#line 4933 "parse_pack.c"
 yy642:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy643;
 	default:	goto yy113;
 	}
 yy643:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy644;
 	default:	goto yy113;
 	}
 yy644:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy645;
 	default:	goto yy113;
 	}
 yy645:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy646;
 	default:	goto yy113;
 	}
 yy646:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy647;
 	default:	goto yy113;
 	}
 yy647:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy648;
 	default:	goto yy113;
 	}
 yy648:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy649;
 	default:	goto yy113;
 	}
 yy649:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy650;
 	default:	goto yy113;
 	}
 yy650:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy651;
 	default:	goto yy113;
 	}
 yy651:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy652;
 	default:	goto yy113;
 	}
 yy652:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy653;
 	default:	goto yy113;
 	}
 yy653:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy654;
 	default:	goto yy112;
 	}
 yy654:
-#line 348 "parse_pack.re"
+#line 386 "parse_pack.re"
 	{ SET_HEADER(Incominglimit); }
-#line 4510 "parse_pack.c"
+#line 5032 "parse_pack.c"
 yy655:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy656;
 	default:	goto yy113;
 	}
 yy656:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy657;
 	default:	goto yy113;
 	}
 yy657:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy658;
 	default:	goto yy112;
 	}
 yy658:
-#line 347 "parse_pack.re"
+#line 385 "parse_pack.re"
 	{ SET_HEADER(Hint); }
-#line 4535 "parse_pack.c"
+#line 5059 "parse_pack.c"
 yy659:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy679;
 	default:	goto yy113;
 	}
 yy660:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy671;
 	default:	goto yy113;
 	}
 yy661:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy666;
 	default:	goto yy113;
 	}
 yy662:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy663;
 	default:	goto yy113;
 	}
 yy663:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy664;
 	default:	goto yy113;
 	}
 yy664:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy665;
 	default:	goto yy112;
 	}
 yy665:
-#line 346 "parse_pack.re"
+#line 384 "parse_pack.re"
 	{ SET_HEADER(From); }
-#line 4581 "parse_pack.c"
+#line 5110 "parse_pack.c"
 yy666:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy667;
 	default:	goto yy113;
 	}
 yy667:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy668;
 	default:	goto yy113;
 	}
 yy668:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy669;
 	default:	goto yy113;
 	}
 yy669:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy670;
 	default:	goto yy112;
 	}
 yy670:
-#line 345 "parse_pack.re"
+#line 383 "parse_pack.re"
 	{ SET_HEADER(Format); }
-#line 4613 "parse_pack.c"
+#line 5145 "parse_pack.c"
 yy671:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy672;
 	default:	goto yy113;
 	}
 yy672:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy673;
 	case 'N':
@@ -4627,96 +5160,106 @@ yy672:
 	default:	goto yy112;
 	}
 yy673:
-#line 343 "parse_pack.re"
+#line 381 "parse_pack.re"
 	{ SET_HEADER(File); }
-#line 4633 "parse_pack.c"
+#line 5166 "parse_pack.c"
 yy674:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy675;
 	default:	goto yy113;
 	}
 yy675:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy676;
 	default:	goto yy113;
 	}
 yy676:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy677;
 	default:	goto yy113;
 	}
 yy677:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy678;
 	default:	goto yy112;
 	}
 yy678:
-#line 344 "parse_pack.re"
+#line 382 "parse_pack.re"
 	{ SET_HEADER(FileName); }
-#line 4665 "parse_pack.c"
+#line 5201 "parse_pack.c"
 yy679:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy680;
 	default:	goto yy113;
 	}
 yy680:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy681;
 	default:	goto yy113;
 	}
 yy681:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'Y':
 	case 'y':	goto yy682;
 	default:	goto yy113;
 	}
 yy682:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy683;
 	default:	goto yy112;
 	}
 yy683:
-#line 342 "parse_pack.re"
+#line 380 "parse_pack.re"
 	{ SET_HEADER(Family); }
-#line 4697 "parse_pack.c"
+#line 5236 "parse_pack.c"
 yy684:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy733;
 	default:	goto yy113;
 	}
 yy685:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy722;
 	default:	goto yy113;
 	}
 yy686:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy687;
 	default:	goto yy113;
 	}
 yy687:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy688;
@@ -4725,21 +5268,24 @@ yy687:
 	default:	goto yy113;
 	}
 yy688:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy715;
 	default:	goto yy113;
 	}
 yy689:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy690;
 	default:	goto yy113;
 	}
 yy690:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy691;
@@ -4748,7 +5294,8 @@ yy690:
 	default:	goto yy113;
 	}
 yy691:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'H':
 	case 'h':	goto yy701;
@@ -4757,160 +5304,177 @@ yy691:
 	default:	goto yy113;
 	}
 yy692:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy693;
 	default:	goto yy113;
 	}
 yy693:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy694;
 	default:	goto yy113;
 	}
 yy694:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy695;
 	default:	goto yy113;
 	}
 yy695:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy696;
 	default:	goto yy113;
 	}
 yy696:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy697;
 	default:	goto yy113;
 	}
 yy697:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy698;
 	default:	goto yy113;
 	}
 yy698:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'Y':
 	case 'y':	goto yy699;
 	default:	goto yy113;
 	}
 yy699:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy700;
 	default:	goto yy112;
 	}
 yy700:
-#line 341 "parse_pack.re"
+#line 379 "parse_pack.re"
 	{ SET_HEADER(ExtraPriority); }
-#line 4819 "parse_pack.c"
+#line 5373 "parse_pack.c"
 yy701:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy709;
 	default:	goto yy113;
 	}
 yy702:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy703;
 	default:	goto yy113;
 	}
 yy703:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy704;
 	default:	goto yy113;
 	}
 yy704:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy705;
 	default:	goto yy113;
 	}
 yy705:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'X':
 	case 'x':	goto yy706;
 	default:	goto yy113;
 	}
 yy706:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy707;
 	default:	goto yy113;
 	}
 yy707:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy708;
 	default:	goto yy112;
 	}
 yy708:
-#line 340 "parse_pack.re"
+#line 378 "parse_pack.re"
 	{ SET_HEADER(ExtraContext); }
-#line 4872 "parse_pack.c"
+#line 5432 "parse_pack.c"
 yy709:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy710;
 	default:	goto yy113;
 	}
 yy710:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy711;
 	default:	goto yy113;
 	}
 yy711:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy712;
 	default:	goto yy113;
 	}
 yy712:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy713;
 	default:	goto yy113;
 	}
 yy713:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy714;
 	default:	goto yy112;
 	}
 yy714:
-#line 339 "parse_pack.re"
+#line 377 "parse_pack.re"
 	{ SET_HEADER(ExtraChannel); }
-#line 4911 "parse_pack.c"
+#line 5475 "parse_pack.c"
 yy715:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy716;
 	case 'S':
@@ -4918,58 +5482,63 @@ yy715:
 	default:	goto yy112;
 	}
 yy716:
-#line 337 "parse_pack.re"
+#line 375 "parse_pack.re"
 	{ SET_HEADER(Exten); }
-#line 4924 "parse_pack.c"
+#line 5488 "parse_pack.c"
 yy717:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy718;
 	default:	goto yy113;
 	}
 yy718:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy719;
 	default:	goto yy113;
 	}
 yy719:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy720;
 	default:	goto yy113;
 	}
 yy720:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy721;
 	default:	goto yy112;
 	}
 yy721:
-#line 338 "parse_pack.re"
+#line 376 "parse_pack.re"
 	{ SET_HEADER(Extension); }
-#line 4956 "parse_pack.c"
+#line 5523 "parse_pack.c"
 yy722:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy723;
 	default:	goto yy113;
 	}
 yy723:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy724;
 	default:	goto yy113;
 	}
 yy724:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy725;
 	case 'L':
@@ -4979,103 +5548,112 @@ yy724:
 	default:	goto yy112;
 	}
 yy725:
-#line 274 "parse_pack.re"
+#line 312 "parse_pack.re"
 	{
               amipack_type (pack, AMI_EVENT);
               SET_HEADER(Event);
             }
-#line 4988 "parse_pack.c"
+#line 5557 "parse_pack.c"
 yy726:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy729;
 	default:	goto yy113;
 	}
 yy727:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy728;
 	default:	goto yy112;
 	}
 yy728:
-#line 336 "parse_pack.re"
+#line 374 "parse_pack.re"
 	{ SET_HEADER(EventsHdr); }
-#line 5006 "parse_pack.c"
+#line 5576 "parse_pack.c"
 yy729:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy730;
 	default:	goto yy113;
 	}
 yy730:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy731;
 	default:	goto yy113;
 	}
 yy731:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy732;
 	default:	goto yy112;
 	}
 yy732:
-#line 335 "parse_pack.re"
+#line 373 "parse_pack.re"
 	{ SET_HEADER(EventList); }
-#line 5031 "parse_pack.c"
+#line 5603 "parse_pack.c"
 yy733:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy734;
 	default:	goto yy113;
 	}
 yy734:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy735;
 	default:	goto yy113;
 	}
 yy735:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy736;
 	default:	goto yy113;
 	}
 yy736:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy737;
 	default:	goto yy113;
 	}
 yy737:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy738;
 	default:	goto yy112;
 	}
 yy738:
-#line 334 "parse_pack.re"
+#line 372 "parse_pack.re"
 	{ SET_HEADER(Endtime); }
-#line 5070 "parse_pack.c"
+#line 5646 "parse_pack.c"
 yy739:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy852;
 	default:	goto yy113;
 	}
 yy740:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'F':
 	case 'f':	goto yy795;
@@ -5084,7 +5662,8 @@ yy740:
 	default:	goto yy113;
 	}
 yy741:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy763;
@@ -5095,286 +5674,319 @@ yy741:
 	default:	goto yy113;
 	}
 yy742:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy758;
 	default:	goto yy113;
 	}
 yy743:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy751;
 	default:	goto yy113;
 	}
 yy744:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy745;
 	default:	goto yy113;
 	}
 yy745:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy746;
 	default:	goto yy113;
 	}
 yy746:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy747;
 	default:	goto yy113;
 	}
 yy747:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy748;
 	default:	goto yy113;
 	}
 yy748:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy749;
 	default:	goto yy113;
 	}
 yy749:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy750;
 	default:	goto yy112;
 	}
 yy750:
-#line 333 "parse_pack.re"
+#line 371 "parse_pack.re"
 	{ SET_HEADER(Dynamic); }
-#line 5157 "parse_pack.c"
+#line 5743 "parse_pack.c"
 yy751:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy752;
 	default:	goto yy113;
 	}
 yy752:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy753;
 	default:	goto yy113;
 	}
 yy753:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy754;
 	default:	goto yy113;
 	}
 yy754:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy755;
 	default:	goto yy113;
 	}
 yy755:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy756;
 	default:	goto yy113;
 	}
 yy756:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy757;
 	default:	goto yy112;
 	}
 yy757:
-#line 332 "parse_pack.re"
+#line 370 "parse_pack.re"
 	{ SET_HEADER(Duration); }
-#line 5203 "parse_pack.c"
+#line 5794 "parse_pack.c"
 yy758:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy759;
 	default:	goto yy113;
 	}
 yy759:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy760;
 	default:	goto yy113;
 	}
 yy760:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy761;
 	default:	goto yy113;
 	}
 yy761:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy762;
 	default:	goto yy112;
 	}
 yy762:
-#line 331 "parse_pack.re"
+#line 369 "parse_pack.re"
 	{ SET_HEADER(Domain); }
-#line 5235 "parse_pack.c"
+#line 5829 "parse_pack.c"
 yy763:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy782;
 	default:	goto yy113;
 	}
 yy764:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy775;
 	default:	goto yy113;
 	}
 yy765:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy766;
 	default:	goto yy113;
 	}
 yy766:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy767;
 	default:	goto yy113;
 	}
 yy767:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy768;
 	default:	goto yy113;
 	}
 yy768:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy769;
 	default:	goto yy113;
 	}
 yy769:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy770;
 	default:	goto yy113;
 	}
 yy770:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy771;
 	default:	goto yy113;
 	}
 yy771:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy772;
 	default:	goto yy113;
 	}
 yy772:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy773;
 	default:	goto yy113;
 	}
 yy773:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy774;
 	default:	goto yy112;
 	}
 yy774:
-#line 330 "parse_pack.re"
+#line 368 "parse_pack.re"
 	{ SET_HEADER(Disposition); }
-#line 5316 "parse_pack.c"
+#line 5920 "parse_pack.c"
 yy775:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy776;
 	default:	goto yy113;
 	}
 yy776:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy777;
 	default:	goto yy113;
 	}
 yy777:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy778;
 	default:	goto yy113;
 	}
 yy778:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy779;
 	default:	goto yy113;
 	}
 yy779:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy780;
 	default:	goto yy113;
 	}
 yy780:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy781;
 	default:	goto yy112;
 	}
 yy781:
-#line 329 "parse_pack.re"
+#line 367 "parse_pack.re"
 	{ SET_HEADER(Direction); }
-#line 5362 "parse_pack.c"
+#line 5971 "parse_pack.c"
 yy782:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy783;
 	default:	goto yy113;
 	}
 yy783:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy784;
 	default:	goto yy113;
 	}
 yy784:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy785;
@@ -5383,85 +5995,94 @@ yy784:
 	default:	goto yy113;
 	}
 yy785:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy791;
 	default:	goto yy113;
 	}
 yy786:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy787;
 	default:	goto yy113;
 	}
 yy787:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy788;
 	default:	goto yy113;
 	}
 yy788:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy789;
 	default:	goto yy113;
 	}
 yy789:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy790;
 	default:	goto yy112;
 	}
 yy790:
-#line 328 "parse_pack.re"
+#line 366 "parse_pack.re"
 	{ SET_HEADER(Dialstring); }
-#line 5424 "parse_pack.c"
+#line 6040 "parse_pack.c"
 yy791:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy792;
 	default:	goto yy113;
 	}
 yy792:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy793;
 	default:	goto yy113;
 	}
 yy793:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy794;
 	default:	goto yy112;
 	}
 yy794:
-#line 327 "parse_pack.re"
+#line 365 "parse_pack.re"
 	{ SET_HEADER(DialStatus); }
-#line 5449 "parse_pack.c"
+#line 6067 "parse_pack.c"
 yy795:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy830;
 	default:	goto yy113;
 	}
 yy796:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy797;
 	default:	goto yy113;
 	}
 yy797:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy798;
@@ -5470,110 +6091,123 @@ yy797:
 	default:	goto yy113;
 	}
 yy798:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy808;
 	default:	goto yy113;
 	}
 yy799:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy800;
 	default:	goto yy113;
 	}
 yy800:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy801;
 	default:	goto yy113;
 	}
 yy801:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'Q':
 	case 'q':	goto yy802;
 	default:	goto yy113;
 	}
 yy802:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy803;
 	default:	goto yy113;
 	}
 yy803:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy804;
 	default:	goto yy113;
 	}
 yy804:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy805;
 	default:	goto yy113;
 	}
 yy805:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy806;
 	default:	goto yy113;
 	}
 yy806:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy807;
 	default:	goto yy112;
 	}
 yy807:
-#line 326 "parse_pack.re"
+#line 364 "parse_pack.re"
 	{ SET_HEADER(DestUniqueID); }
-#line 5539 "parse_pack.c"
+#line 6168 "parse_pack.c"
 yy808:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy809;
 	default:	goto yy113;
 	}
 yy809:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy810;
 	default:	goto yy113;
 	}
 yy810:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy811;
 	default:	goto yy113;
 	}
 yy811:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy812;
 	default:	goto yy113;
 	}
 yy812:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy813;
 	default:	goto yy113;
 	}
 yy813:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy814;
 	case 'C':
@@ -5581,11 +6215,12 @@ yy813:
 	default:	goto yy112;
 	}
 yy814:
-#line 323 "parse_pack.re"
+#line 361 "parse_pack.re"
 	{ SET_HEADER(Destination); }
-#line 5587 "parse_pack.c"
+#line 6221 "parse_pack.c"
 yy815:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'H':
 	case 'h':	goto yy816;
@@ -5594,126 +6229,141 @@ yy815:
 	default:	goto yy113;
 	}
 yy816:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy824;
 	default:	goto yy113;
 	}
 yy817:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy818;
 	default:	goto yy113;
 	}
 yy818:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy819;
 	default:	goto yy113;
 	}
 yy819:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy820;
 	default:	goto yy113;
 	}
 yy820:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'X':
 	case 'x':	goto yy821;
 	default:	goto yy113;
 	}
 yy821:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy822;
 	default:	goto yy113;
 	}
 yy822:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy823;
 	default:	goto yy112;
 	}
 yy823:
-#line 325 "parse_pack.re"
+#line 363 "parse_pack.re"
 	{ SET_HEADER(DestinationContext); }
-#line 5649 "parse_pack.c"
+#line 6290 "parse_pack.c"
 yy824:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy825;
 	default:	goto yy113;
 	}
 yy825:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy826;
 	default:	goto yy113;
 	}
 yy826:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy827;
 	default:	goto yy113;
 	}
 yy827:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy828;
 	default:	goto yy113;
 	}
 yy828:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy829;
 	default:	goto yy112;
 	}
 yy829:
-#line 324 "parse_pack.re"
+#line 362 "parse_pack.re"
 	{ SET_HEADER(DestinationChannel); }
-#line 5688 "parse_pack.c"
+#line 6333 "parse_pack.c"
 yy830:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy831;
 	default:	goto yy113;
 	}
 yy831:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy832;
 	default:	goto yy113;
 	}
 yy832:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy833;
 	default:	goto yy113;
 	}
 yy833:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '-':	goto yy834;
 	default:	goto yy113;
 	}
 yy834:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy835;
@@ -5722,137 +6372,152 @@ yy834:
 	default:	goto yy113;
 	}
 yy835:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy845;
 	default:	goto yy113;
 	}
 yy836:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy837;
 	default:	goto yy113;
 	}
 yy837:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy838;
 	default:	goto yy113;
 	}
 yy838:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy839;
 	default:	goto yy113;
 	}
 yy839:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy840;
 	default:	goto yy113;
 	}
 yy840:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy841;
 	default:	goto yy113;
 	}
 yy841:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy842;
 	default:	goto yy113;
 	}
 yy842:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy843;
 	default:	goto yy113;
 	}
 yy843:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy844;
 	default:	goto yy112;
 	}
 yy844:
-#line 322 "parse_pack.re"
+#line 360 "parse_pack.re"
 	{ SET_HEADER(Default_Username); }
-#line 5791 "parse_pack.c"
+#line 6449 "parse_pack.c"
 yy845:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy846;
 	default:	goto yy113;
 	}
 yy846:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy847;
 	default:	goto yy113;
 	}
 yy847:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '-':	goto yy848;
 	default:	goto yy113;
 	}
 yy848:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy849;
 	default:	goto yy113;
 	}
 yy849:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy850;
 	default:	goto yy113;
 	}
 yy850:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy851;
 	default:	goto yy112;
 	}
 yy851:
-#line 321 "parse_pack.re"
+#line 359 "parse_pack.re"
 	{ SET_HEADER(Default_addr_IP); }
-#line 5836 "parse_pack.c"
+#line 6499 "parse_pack.c"
 yy852:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy853;
 	default:	goto yy113;
 	}
 yy853:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy854;
 	default:	goto yy112;
 	}
 yy854:
-#line 320 "parse_pack.re"
+#line 358 "parse_pack.re"
 	{ SET_HEADER(Data); }
-#line 5854 "parse_pack.c"
+#line 6518 "parse_pack.c"
 yy855:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy955;
@@ -5861,21 +6526,24 @@ yy855:
 	default:	goto yy113;
 	}
 yy856:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy918;
 	default:	goto yy113;
 	}
 yy857:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy904;
 	default:	goto yy113;
 	}
 yy858:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy859;
@@ -5888,21 +6556,24 @@ yy858:
 	default:	goto yy113;
 	}
 yy859:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy894;
 	default:	goto yy113;
 	}
 yy860:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy889;
 	default:	goto yy113;
 	}
 yy861:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy866;
@@ -5911,134 +6582,150 @@ yy861:
 	default:	goto yy113;
 	}
 yy862:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy863;
 	default:	goto yy113;
 	}
 yy863:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy864;
 	default:	goto yy113;
 	}
 yy864:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy865;
 	default:	goto yy112;
 	}
 yy865:
-#line 319 "parse_pack.re"
+#line 357 "parse_pack.re"
 	{ SET_HEADER(Count); }
-#line 5938 "parse_pack.c"
+#line 6611 "parse_pack.c"
 yy866:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy872;
 	default:	goto yy113;
 	}
 yy867:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy868;
 	default:	goto yy113;
 	}
 yy868:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'X':
 	case 'x':	goto yy869;
 	default:	goto yy113;
 	}
 yy869:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy870;
 	default:	goto yy113;
 	}
 yy870:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy871;
 	default:	goto yy112;
 	}
 yy871:
-#line 318 "parse_pack.re"
+#line 356 "parse_pack.re"
 	{ SET_HEADER(Context); }
-#line 5977 "parse_pack.c"
+#line 6654 "parse_pack.c"
 yy872:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy873;
 	default:	goto yy113;
 	}
 yy873:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy874;
 	default:	goto yy113;
 	}
 yy874:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy875;
 	default:	goto yy113;
 	}
 yy875:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy876;
 	default:	goto yy113;
 	}
 yy876:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy877;
 	default:	goto yy113;
 	}
 yy877:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy878;
 	default:	goto yy113;
 	}
 yy878:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy879;
 	default:	goto yy113;
 	}
 yy879:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy880;
 	default:	goto yy113;
 	}
 yy880:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy881;
 	default:	goto yy113;
 	}
 yy881:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy882;
@@ -6047,89 +6734,97 @@ yy881:
 	default:	goto yy113;
 	}
 yy882:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy886;
 	default:	goto yy113;
 	}
 yy883:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy884;
 	default:	goto yy113;
 	}
 yy884:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy885;
 	default:	goto yy112;
 	}
 yy885:
-#line 317 "parse_pack.re"
+#line 355 "parse_pack.re"
 	{ SET_HEADER(ConnectedLineNum); }
-#line 6074 "parse_pack.c"
+#line 6763 "parse_pack.c"
 yy886:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy887;
 	default:	goto yy113;
 	}
 yy887:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy888;
 	default:	goto yy112;
 	}
 yy888:
-#line 316 "parse_pack.re"
+#line 354 "parse_pack.re"
 	{ SET_HEADER(ConnectedLineName); }
-#line 6092 "parse_pack.c"
+#line 6782 "parse_pack.c"
 yy889:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy890;
 	default:	goto yy113;
 	}
 yy890:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy891;
 	default:	goto yy113;
 	}
 yy891:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy892;
 	default:	goto yy113;
 	}
 yy892:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy893;
 	default:	goto yy112;
 	}
 yy893:
-#line 315 "parse_pack.re"
+#line 353 "parse_pack.re"
 	{ SET_HEADER(CommandHdr); }
-#line 6124 "parse_pack.c"
+#line 6817 "parse_pack.c"
 yy894:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy895;
 	default:	goto yy113;
 	}
 yy895:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy896;
@@ -6138,158 +6833,176 @@ yy895:
 	default:	goto yy113;
 	}
 yy896:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy899;
 	default:	goto yy113;
 	}
 yy897:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy898;
 	default:	goto yy112;
 	}
 yy898:
-#line 314 "parse_pack.re"
+#line 352 "parse_pack.re"
 	{ SET_HEADER(Codecs); }
-#line 6158 "parse_pack.c"
+#line 6854 "parse_pack.c"
 yy899:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy900;
 	default:	goto yy113;
 	}
 yy900:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy901;
 	default:	goto yy113;
 	}
 yy901:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy902;
 	default:	goto yy113;
 	}
 yy902:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy903;
 	default:	goto yy112;
 	}
 yy903:
-#line 313 "parse_pack.re"
+#line 351 "parse_pack.re"
 	{ SET_HEADER(CodecOrder); }
-#line 6190 "parse_pack.c"
+#line 6889 "parse_pack.c"
 yy904:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '-':	goto yy905;
 	default:	goto yy113;
 	}
 yy905:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy906;
 	default:	goto yy113;
 	}
 yy906:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy907;
 	default:	goto yy113;
 	}
 yy907:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy908;
 	default:	goto yy113;
 	}
 yy908:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy909;
 	default:	goto yy113;
 	}
 yy909:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy910;
 	default:	goto yy113;
 	}
 yy910:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy911;
 	default:	goto yy113;
 	}
 yy911:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy912;
 	default:	goto yy113;
 	}
 yy912:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy913;
 	default:	goto yy113;
 	}
 yy913:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy914;
 	default:	goto yy113;
 	}
 yy914:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy915;
 	default:	goto yy113;
 	}
 yy915:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy916;
 	default:	goto yy113;
 	}
 yy916:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy917;
 	default:	goto yy112;
 	}
 yy917:
-#line 312 "parse_pack.re"
+#line 350 "parse_pack.re"
 	{ SET_HEADER(CID_CallingPres); }
-#line 6284 "parse_pack.c"
+#line 6995 "parse_pack.c"
 yy918:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy919;
 	default:	goto yy113;
 	}
 yy919:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy920;
@@ -6298,96 +7011,107 @@ yy919:
 	default:	goto yy113;
 	}
 yy920:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy932;
 	default:	goto yy113;
 	}
 yy921:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'B':
 	case 'b':	goto yy922;
 	default:	goto yy113;
 	}
 yy922:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'J':
 	case 'j':	goto yy923;
 	default:	goto yy113;
 	}
 yy923:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy924;
 	default:	goto yy113;
 	}
 yy924:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy925;
 	default:	goto yy113;
 	}
 yy925:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy926;
 	default:	goto yy113;
 	}
 yy926:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy927;
 	default:	goto yy113;
 	}
 yy927:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'Y':
 	case 'y':	goto yy928;
 	default:	goto yy113;
 	}
 yy928:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy929;
 	default:	goto yy113;
 	}
 yy929:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy930;
 	default:	goto yy113;
 	}
 yy930:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy931;
 	default:	goto yy112;
 	}
 yy931:
-#line 311 "parse_pack.re"
+#line 349 "parse_pack.re"
 	{ SET_HEADER(ChanObjectType); }
-#line 6381 "parse_pack.c"
+#line 7104 "parse_pack.c"
 yy932:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy933;
 	default:	goto yy113;
 	}
 yy933:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy934;
 	case '1':	goto yy935;
@@ -6399,94 +7123,101 @@ yy933:
 	default:	goto yy112;
 	}
 yy934:
-#line 305 "parse_pack.re"
+#line 343 "parse_pack.re"
 	{ SET_HEADER(Channel); }
-#line 6405 "parse_pack.c"
+#line 7129 "parse_pack.c"
 yy935:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy936;
 	default:	goto yy112;
 	}
 yy936:
-#line 306 "parse_pack.re"
+#line 344 "parse_pack.re"
 	{ SET_HEADER(Channel1); }
-#line 6416 "parse_pack.c"
+#line 7140 "parse_pack.c"
 yy937:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy938;
 	default:	goto yy112;
 	}
 yy938:
-#line 307 "parse_pack.re"
+#line 345 "parse_pack.re"
 	{ SET_HEADER(Channel2); }
-#line 6427 "parse_pack.c"
+#line 7151 "parse_pack.c"
 yy939:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy945;
 	default:	goto yy113;
 	}
 yy940:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'Y':
 	case 'y':	goto yy941;
 	default:	goto yy113;
 	}
 yy941:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy942;
 	default:	goto yy113;
 	}
 yy942:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy943;
 	default:	goto yy113;
 	}
 yy943:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy944;
 	default:	goto yy112;
 	}
 yy944:
-#line 310 "parse_pack.re"
+#line 348 "parse_pack.re"
 	{ SET_HEADER(ChannelType); }
-#line 6466 "parse_pack.c"
+#line 7194 "parse_pack.c"
 yy945:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy946;
 	default:	goto yy113;
 	}
 yy946:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy947;
 	default:	goto yy113;
 	}
 yy947:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy948;
 	default:	goto yy113;
 	}
 yy948:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy949;
 	case 'D':
@@ -6494,108 +7225,118 @@ yy948:
 	default:	goto yy112;
 	}
 yy949:
-#line 308 "parse_pack.re"
+#line 346 "parse_pack.re"
 	{ SET_HEADER(ChannelState); }
-#line 6500 "parse_pack.c"
+#line 7231 "parse_pack.c"
 yy950:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy951;
 	default:	goto yy113;
 	}
 yy951:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy952;
 	default:	goto yy113;
 	}
 yy952:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy953;
 	default:	goto yy113;
 	}
 yy953:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy954;
 	default:	goto yy112;
 	}
 yy954:
-#line 309 "parse_pack.re"
+#line 347 "parse_pack.re"
 	{ SET_HEADER(ChannelStateDesc); }
-#line 6532 "parse_pack.c"
+#line 7266 "parse_pack.c"
 yy955:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy965;
 	default:	goto yy113;
 	}
 yy956:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy957;
 	default:	goto yy113;
 	}
 yy957:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy958;
 	default:	goto yy113;
 	}
 yy958:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy959;
 	case '-':	goto yy960;
 	default:	goto yy112;
 	}
 yy959:
-#line 303 "parse_pack.re"
+#line 341 "parse_pack.re"
 	{ SET_HEADER(Cause); }
-#line 6565 "parse_pack.c"
+#line 7302 "parse_pack.c"
 yy960:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy961;
 	default:	goto yy113;
 	}
 yy961:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'X':
 	case 'x':	goto yy962;
 	default:	goto yy113;
 	}
 yy962:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy963;
 	default:	goto yy113;
 	}
 yy963:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy964;
 	default:	goto yy112;
 	}
 yy964:
-#line 304 "parse_pack.re"
+#line 342 "parse_pack.re"
 	{ SET_HEADER(Cause_txt); }
-#line 6597 "parse_pack.c"
+#line 7337 "parse_pack.c"
 yy965:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy966;
@@ -6606,114 +7347,126 @@ yy965:
 	default:	goto yy113;
 	}
 yy966:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy980;
 	default:	goto yy113;
 	}
 yy967:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy975;
 	default:	goto yy113;
 	}
 yy968:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy969;
 	default:	goto yy113;
 	}
 yy969:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy970;
 	default:	goto yy113;
 	}
 yy970:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'K':
 	case 'k':	goto yy971;
 	default:	goto yy113;
 	}
 yy971:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy972;
 	default:	goto yy113;
 	}
 yy972:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy973;
 	default:	goto yy113;
 	}
 yy973:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy974;
 	default:	goto yy112;
 	}
 yy974:
-#line 302 "parse_pack.re"
+#line 340 "parse_pack.re"
 	{ SET_HEADER(CallsTaken); }
-#line 6668 "parse_pack.c"
+#line 7416 "parse_pack.c"
 yy975:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy976;
 	default:	goto yy113;
 	}
 yy976:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy977;
 	default:	goto yy113;
 	}
 yy977:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy978;
 	default:	goto yy113;
 	}
 yy978:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy979;
 	default:	goto yy112;
 	}
 yy979:
-#line 301 "parse_pack.re"
+#line 339 "parse_pack.re"
 	{ SET_HEADER(Callgroup); }
-#line 6700 "parse_pack.c"
+#line 7451 "parse_pack.c"
 yy980:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy981;
 	default:	goto yy113;
 	}
 yy981:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy982;
 	default:	goto yy113;
 	}
 yy982:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy983;
 	case '1':	goto yy984;
@@ -6723,33 +7476,34 @@ yy982:
 	default:	goto yy112;
 	}
 yy983:
-#line 296 "parse_pack.re"
+#line 334 "parse_pack.re"
 	{ SET_HEADER(CallerID); }
-#line 6729 "parse_pack.c"
+#line 7482 "parse_pack.c"
 yy984:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy985;
 	default:	goto yy112;
 	}
 yy985:
-#line 297 "parse_pack.re"
+#line 335 "parse_pack.re"
 	{ SET_HEADER(CallerID1); }
-#line 6740 "parse_pack.c"
+#line 7493 "parse_pack.c"
 yy986:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy987;
 	default:	goto yy112;
 	}
 yy987:
-#line 298 "parse_pack.re"
+#line 336 "parse_pack.re"
 	{ SET_HEADER(CallerID2); }
-#line 6751 "parse_pack.c"
+#line 7504 "parse_pack.c"
 yy988:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy989;
@@ -6758,85 +7512,94 @@ yy988:
 	default:	goto yy113;
 	}
 yy989:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy993;
 	default:	goto yy113;
 	}
 yy990:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy991;
 	default:	goto yy113;
 	}
 yy991:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy992;
 	default:	goto yy112;
 	}
 yy992:
-#line 300 "parse_pack.re"
+#line 338 "parse_pack.re"
 	{ SET_HEADER(CallerIDNum); }
-#line 6785 "parse_pack.c"
+#line 7541 "parse_pack.c"
 yy993:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy994;
 	default:	goto yy113;
 	}
 yy994:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy995;
 	default:	goto yy112;
 	}
 yy995:
-#line 299 "parse_pack.re"
+#line 337 "parse_pack.re"
 	{ SET_HEADER(CallerIDName); }
-#line 6803 "parse_pack.c"
+#line 7560 "parse_pack.c"
 yy996:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy1013;
 	default:	goto yy113;
 	}
 yy997:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy998;
 	default:	goto yy113;
 	}
 yy998:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy999;
 	default:	goto yy113;
 	}
 yy999:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy1000;
 	default:	goto yy113;
 	}
 yy1000:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy1001;
 	default:	goto yy113;
 	}
 yy1001:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy1002;
@@ -6845,173 +7608,193 @@ yy1001:
 	default:	goto yy113;
 	}
 yy1002:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy1008;
 	default:	goto yy113;
 	}
 yy1003:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'Y':
 	case 'y':	goto yy1004;
 	default:	goto yy113;
 	}
 yy1004:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy1005;
 	default:	goto yy113;
 	}
 yy1005:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy1006;
 	default:	goto yy113;
 	}
 yy1006:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1007;
 	default:	goto yy112;
 	}
 yy1007:
-#line 295 "parse_pack.re"
+#line 333 "parse_pack.re"
 	{ SET_HEADER(Bridgetype); }
-#line 6886 "parse_pack.c"
+#line 7653 "parse_pack.c"
 yy1008:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy1009;
 	default:	goto yy113;
 	}
 yy1009:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy1010;
 	default:	goto yy113;
 	}
 yy1010:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy1011;
 	default:	goto yy113;
 	}
 yy1011:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1012;
 	default:	goto yy112;
 	}
 yy1012:
-#line 294 "parse_pack.re"
+#line 332 "parse_pack.re"
 	{ SET_HEADER(Bridgestate); }
-#line 6918 "parse_pack.c"
+#line 7688 "parse_pack.c"
 yy1013:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy1014;
 	default:	goto yy113;
 	}
 yy1014:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy1015;
 	default:	goto yy113;
 	}
 yy1015:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'B':
 	case 'b':	goto yy1016;
 	default:	goto yy113;
 	}
 yy1016:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy1017;
 	default:	goto yy113;
 	}
 yy1017:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy1018;
 	default:	goto yy113;
 	}
 yy1018:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy1019;
 	default:	goto yy113;
 	}
 yy1019:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy1020;
 	default:	goto yy113;
 	}
 yy1020:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy1021;
 	default:	goto yy113;
 	}
 yy1021:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy1022;
 	default:	goto yy113;
 	}
 yy1022:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy1023;
 	default:	goto yy113;
 	}
 yy1023:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy1024;
 	default:	goto yy113;
 	}
 yy1024:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy1025;
 	default:	goto yy113;
 	}
 yy1025:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1026;
 	default:	goto yy112;
 	}
 yy1026:
-#line 293 "parse_pack.re"
+#line 331 "parse_pack.re"
 	{ SET_HEADER(BillableSeconds); }
-#line 7013 "parse_pack.c"
+#line 7795 "parse_pack.c"
 yy1027:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy1096;
@@ -7022,127 +7805,142 @@ yy1027:
 	default:	goto yy113;
 	}
 yy1028:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy1080;
 	default:	goto yy113;
 	}
 yy1029:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy1076;
 	default:	goto yy113;
 	}
 yy1030:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy1069;
 	default:	goto yy113;
 	}
 yy1031:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy1060;
 	default:	goto yy113;
 	}
 yy1032:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy1046;
 	default:	goto yy113;
 	}
 yy1033:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'Y':
 	case 'y':	goto yy1042;
 	default:	goto yy113;
 	}
 yy1034:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy1035;
 	default:	goto yy113;
 	}
 yy1035:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'H':
 	case 'h':	goto yy1036;
 	default:	goto yy113;
 	}
 yy1036:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy1037;
 	default:	goto yy113;
 	}
 yy1037:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'Y':
 	case 'y':	goto yy1038;
 	default:	goto yy113;
 	}
 yy1038:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy1039;
 	default:	goto yy113;
 	}
 yy1039:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy1040;
 	default:	goto yy113;
 	}
 yy1040:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1041;
 	default:	goto yy112;
 	}
 yy1041:
-#line 292 "parse_pack.re"
+#line 330 "parse_pack.re"
 	{ SET_HEADER(AuthType); }
-#line 7119 "parse_pack.c"
+#line 7914 "parse_pack.c"
 yy1042:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy1043;
 	default:	goto yy113;
 	}
 yy1043:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy1044;
 	default:	goto yy113;
 	}
 yy1044:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1045;
 	default:	goto yy112;
 	}
 yy1045:
-#line 291 "parse_pack.re"
+#line 329 "parse_pack.re"
 	{ SET_HEADER(Async); }
-#line 7144 "parse_pack.c"
+#line 7941 "parse_pack.c"
 yy1046:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy1047;
@@ -7151,263 +7949,291 @@ yy1046:
 	default:	goto yy113;
 	}
 yy1047:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy1057;
 	default:	goto yy113;
 	}
 yy1048:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy1049;
 	default:	goto yy113;
 	}
 yy1049:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'C':
 	case 'c':	goto yy1050;
 	default:	goto yy113;
 	}
 yy1050:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy1051;
 	default:	goto yy113;
 	}
 yy1051:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy1052;
 	default:	goto yy113;
 	}
 yy1052:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy1053;
 	default:	goto yy113;
 	}
 yy1053:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy1054;
 	default:	goto yy113;
 	}
 yy1054:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy1055;
 	default:	goto yy113;
 	}
 yy1055:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1056;
 	default:	goto yy112;
 	}
 yy1056:
-#line 290 "parse_pack.re"
+#line 328 "parse_pack.re"
 	{ SET_HEADER(Application); }
-#line 7220 "parse_pack.c"
+#line 8026 "parse_pack.c"
 yy1057:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy1058;
 	default:	goto yy113;
 	}
 yy1058:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1059;
 	default:	goto yy112;
 	}
 yy1059:
-#line 289 "parse_pack.re"
+#line 327 "parse_pack.re"
 	{ SET_HEADER(Append); }
-#line 7238 "parse_pack.c"
+#line 8045 "parse_pack.c"
 yy1060:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'W':
 	case 'w':	goto yy1061;
 	default:	goto yy113;
 	}
 yy1061:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy1062;
 	default:	goto yy113;
 	}
 yy1062:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy1063;
 	default:	goto yy113;
 	}
 yy1063:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy1064;
 	default:	goto yy113;
 	}
 yy1064:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy1065;
 	default:	goto yy113;
 	}
 yy1065:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'M':
 	case 'm':	goto yy1066;
 	default:	goto yy113;
 	}
 yy1066:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy1067;
 	default:	goto yy113;
 	}
 yy1067:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1068;
 	default:	goto yy112;
 	}
 yy1068:
-#line 288 "parse_pack.re"
+#line 326 "parse_pack.re"
 	{ SET_HEADER(AnswerTime); }
-#line 7298 "parse_pack.c"
+#line 8112 "parse_pack.c"
 yy1069:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'F':
 	case 'f':	goto yy1070;
 	default:	goto yy113;
 	}
 yy1070:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'L':
 	case 'l':	goto yy1071;
 	default:	goto yy113;
 	}
 yy1071:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'A':
 	case 'a':	goto yy1072;
 	default:	goto yy113;
 	}
 yy1072:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'G':
 	case 'g':	goto yy1073;
 	default:	goto yy113;
 	}
 yy1073:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy1074;
 	default:	goto yy113;
 	}
 yy1074:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1075;
 	default:	goto yy112;
 	}
 yy1075:
-#line 287 "parse_pack.re"
+#line 325 "parse_pack.re"
 	{ SET_HEADER(AMAflags); }
-#line 7344 "parse_pack.c"
+#line 8163 "parse_pack.c"
 yy1076:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy1077;
 	default:	goto yy113;
 	}
 yy1077:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy1078;
 	default:	goto yy113;
 	}
 yy1078:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1079;
 	default:	goto yy112;
 	}
 yy1079:
-#line 286 "parse_pack.re"
+#line 324 "parse_pack.re"
 	{ SET_HEADER(Agent); }
-#line 7369 "parse_pack.c"
+#line 8190 "parse_pack.c"
 yy1080:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy1081;
 	default:	goto yy113;
 	}
 yy1081:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy1082;
 	default:	goto yy113;
 	}
 yy1082:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy1083;
 	default:	goto yy113;
 	}
 yy1083:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'S':
 	case 's':	goto yy1084;
 	default:	goto yy113;
 	}
 yy1084:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1085;
 	case '-':	goto yy1086;
 	default:	goto yy112;
 	}
 yy1085:
-#line 283 "parse_pack.re"
+#line 321 "parse_pack.re"
 	{ SET_HEADER(Address); }
-#line 7409 "parse_pack.c"
+#line 8234 "parse_pack.c"
 yy1086:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy1087;
@@ -7416,104 +8242,113 @@ yy1086:
 	default:	goto yy113;
 	}
 yy1087:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'P':
 	case 'p':	goto yy1093;
 	default:	goto yy113;
 	}
 yy1088:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy1089;
 	default:	goto yy113;
 	}
 yy1089:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'R':
 	case 'r':	goto yy1090;
 	default:	goto yy113;
 	}
 yy1090:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy1091;
 	default:	goto yy113;
 	}
 yy1091:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1092;
 	default:	goto yy112;
 	}
 yy1092:
-#line 285 "parse_pack.re"
+#line 323 "parse_pack.re"
 	{ SET_HEADER(Address_Port); }
-#line 7457 "parse_pack.c"
+#line 8287 "parse_pack.c"
 yy1093:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1094;
 	default:	goto yy112;
 	}
 yy1094:
-#line 284 "parse_pack.re"
+#line 322 "parse_pack.re"
 	{ SET_HEADER(Address_IP); }
-#line 7468 "parse_pack.c"
+#line 8298 "parse_pack.c"
 yy1095:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'I':
 	case 'i':	goto yy1109;
 	default:	goto yy113;
 	}
 yy1096:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy1099;
 	default:	goto yy113;
 	}
 yy1097:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1098;
 	default:	goto yy112;
 	}
 yy1098:
-#line 281 "parse_pack.re"
+#line 319 "parse_pack.re"
 	{ SET_HEADER(ACL); }
-#line 7493 "parse_pack.c"
+#line 8325 "parse_pack.c"
 yy1099:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'U':
 	case 'u':	goto yy1100;
 	default:	goto yy113;
 	}
 yy1100:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy1101;
 	default:	goto yy113;
 	}
 yy1101:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'T':
 	case 't':	goto yy1102;
 	default:	goto yy113;
 	}
 yy1102:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1103;
 	case 'C':
@@ -7521,58 +8356,63 @@ yy1102:
 	default:	goto yy112;
 	}
 yy1103:
-#line 279 "parse_pack.re"
+#line 317 "parse_pack.re"
 	{ SET_HEADER(Account); }
-#line 7527 "parse_pack.c"
+#line 8362 "parse_pack.c"
 yy1104:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy1105;
 	default:	goto yy113;
 	}
 yy1105:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy1106;
 	default:	goto yy113;
 	}
 yy1106:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'E':
 	case 'e':	goto yy1107;
 	default:	goto yy113;
 	}
 yy1107:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1108;
 	default:	goto yy112;
 	}
 yy1108:
-#line 280 "parse_pack.re"
+#line 318 "parse_pack.re"
 	{ SET_HEADER(AccountCode); }
-#line 7559 "parse_pack.c"
+#line 8397 "parse_pack.c"
 yy1109:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'O':
 	case 'o':	goto yy1110;
 	default:	goto yy113;
 	}
 yy1110:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'N':
 	case 'n':	goto yy1111;
 	default:	goto yy113;
 	}
 yy1111:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1112;
 	case 'I':
@@ -7580,34 +8420,36 @@ yy1111:
 	default:	goto yy112;
 	}
 yy1112:
-#line 270 "parse_pack.re"
+#line 308 "parse_pack.re"
 	{
               amipack_type (pack, AMI_ACTION);
               SET_HEADER(Action);
             }
-#line 7589 "parse_pack.c"
+#line 8429 "parse_pack.c"
 yy1113:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case 'D':
 	case 'd':	goto yy1114;
 	default:	goto yy113;
 	}
 yy1114:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1115;
 	default:	goto yy112;
 	}
 yy1115:
-#line 282 "parse_pack.re"
+#line 320 "parse_pack.re"
 	{ SET_HEADER(ActionID); }
-#line 7607 "parse_pack.c"
+#line 8448 "parse_pack.c"
 yy1116:
 	yyaccept = 0;
-	marker = ++cur;
-	yych = *cur;
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 yy1117:
 	switch (yych) {
 	case '\r':	goto yy1118;
@@ -7615,14 +8457,16 @@ yy1117:
 	default:	goto yy90;
 	}
 yy1118:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy1119;
 	default:	goto yy354;
 	}
 yy1119:
-	yych = *++cur;
-	ctxmarker = cur;
+	YYSKIP ();
+	yych = YYPEEK ();
+	YYBACKUPCTX ();
 	switch (yych) {
 	case '\r':	goto yy1120;
 	case 'A':
@@ -7680,107 +8524,102 @@ yy1119:
 	default:	goto yy354;
 	}
 yy1120:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy1123;
 	default:	goto yy354;
 	}
 yy1121:
-	++cur;
-	cur = ctxmarker;
-#line 240 "parse_pack.re"
+	YYSKIP ();
+	YYRESTORECTX ();
+#line 285 "parse_pack.re"
 	{
+              NAMED_HEADER();
               tok = cur;
-              if (hdr_type == HDR_UNKNOWN) {
-                amipack_append_unknown (pack, hdr_name, NULL);
-              } else {
-                amipack_append (pack, hdr_type, NULL);
-              }
+              APPEND_HEADER(hdr_type, hdr_name, hdr_len, NULL, 0);
               goto yyc_key;
             }
-#line 7702 "parse_pack.c"
+#line 8544 "parse_pack.c"
 yy1123:
-	++cur;
-#line 249 "parse_pack.re"
+	YYSKIP ();
+#line 291 "parse_pack.re"
 	{
+              NAMED_HEADER();
               tok = cur;
-              if (hdr_type == HDR_UNKNOWN) {
-                amipack_append_unknown (pack, hdr_name, NULL);
-                if(hdr_name) free (hdr_name);
-              } else {
-                amipack_append (pack, hdr_type, NULL);
-              }
+              APPEND_HEADER(hdr_type, hdr_name, hdr_len, NULL, 0);
               goto done;
             }
-#line 7716 "parse_pack.c"
+#line 8554 "parse_pack.c"
 yy1125:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\r':	goto yy1126;
 	default:	goto yy113;
 	}
 yy1126:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy1127;
 	default:	goto yy113;
 	}
 yy1127:
-	++cur;
-	switch ((yych = *cur)) {
+	YYSKIP ();
+	switch ((yych = YYPEEK ())) {
 	case ' ':
 	case ':':	goto yy1128;
 	default:	goto yy112;
 	}
 yy1128:
-#line 237 "parse_pack.re"
+#line 278 "parse_pack.re"
 	{ goto done; }
-#line 7739 "parse_pack.c"
+#line 8579 "parse_pack.c"
 /* *********************************** */
 yyc_value:
-	yych = *cur;
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy1133;
 	case '\r':	goto yy1135;
 	default:	goto yy1132;
 	}
 yy1131:
-#line 427 "parse_pack.re"
+#line 464 "parse_pack.re"
 	{
-              len = cur - tok;
-              char *val = substr(tok, len, 0);
-              if (hdr_type == HDR_UNKNOWN) {
-                amipack_append_unknown (pack, hdr_name, val);
-                if(hdr_name) free (hdr_name);
-              } else {
-                amipack_append (pack, hdr_type, val);
-              }
-              if(val) free (val);
+              if (WANTED(hdr_type)) {
+                if (amipack_append_n (pack, hdr_type, hdr_name, hdr_len,
+                                      tok, cur - tok) != RV_SUCCESS)
+                  goto nomem;
+              } else if (hdr_type == Event)
+                pack->event = event_type_id (tok, cur - tok);
+              else if (hdr_type == Action)
+                pack->action = action_type_id (tok, cur - tok);
               goto yyc_value;
             }
-#line 7762 "parse_pack.c"
+#line 8601 "parse_pack.c"
 yy1132:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	goto yy1144;
 yy1133:
-	++cur;
+	YYSKIP ();
 yy1134:
-#line 232 "parse_pack.re"
-	{
-              if (hdr_name) free (hdr_name);
-              amipack_destroy (pack);
-              return NULL;
-            }
-#line 7775 "parse_pack.c"
+#line 277 "parse_pack.re"
+	{ goto fail; }
+#line 8611 "parse_pack.c"
 yy1135:
-	yych = *(marker = ++cur);
+	YYSKIP ();
+	YYBACKUP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy1136;
 	default:	goto yy1134;
 	}
 yy1136:
-	yych = *++cur;
-	ctxmarker = cur;
+	YYSKIP ();
+	yych = YYPEEK ();
+	YYBACKUPCTX ();
 	switch (yych) {
 	case '\r':	goto yy1138;
 	case 'A':
@@ -7838,28 +8677,29 @@ yy1136:
 	default:	goto yy1137;
 	}
 yy1137:
-	cur = marker;
+	YYRESTORE ();
 	goto yy1134;
 yy1138:
-	yych = *++cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 	switch (yych) {
 	case '\n':	goto yy1141;
 	default:	goto yy1137;
 	}
 yy1139:
-	++cur;
-	cur = ctxmarker;
-#line 426 "parse_pack.re"
-	{ tok = cur - 1; goto yyc_key; }
-#line 7855 "parse_pack.c"
+	YYSKIP ();
+	YYRESTORECTX ();
+#line 463 "parse_pack.re"
+	{ tok = cur; goto yyc_key; }
+#line 8695 "parse_pack.c"
 yy1141:
-	++cur;
-#line 237 "parse_pack.re"
+	YYSKIP ();
+#line 278 "parse_pack.re"
 	{ goto done; }
-#line 7860 "parse_pack.c"
+#line 8700 "parse_pack.c"
 yy1143:
-	++cur;
-	yych = *cur;
+	YYSKIP ();
+	yych = YYPEEK ();
 yy1144:
 	switch (yych) {
 	case '\n':
@@ -7867,9 +8707,82 @@ yy1144:
 	default:	goto yy1143;
 	}
 }
-#line 452 "parse_pack.re"
+#line 486 "parse_pack.re"
 
 
 done:
+  return RV_SUCCESS;
+
+fail:
+  return RV_FAIL;
+
+nomem:
+  return RV_ENOMEM;
+}
+
+/**
+ * Create AMI packet and parse headers.
+ * @param buf       Bytes array received from server
+ * @param size      Packet length in bytes array
+ * @param mode      Packet memory mode
+ * @param wanted    Set of header types to keep or NULL
+ * @return AMIPacket pointer or NULL if AMI packet failed to parse.
+ */
+static AMIPacket *parse_new_pack (const char *buf, size_t size,
+                                  enum pack_mode mode, const AMIHdrSet *wanted)
+{
+  AMIPacket *pack = amipack_init_mode (mode);
+
+  if (pack == NULL)
+    return NULL;
+
+  if (parse_pack (pack, buf, size, wanted) != RV_SUCCESS) {
+    amipack_destroy (pack);
+    return NULL;
+  }
   return pack;
 }
+
+// packet is not bounded, scanner stops on packet end
+AMIPacket *amiparse_pack (const char *pack_str)
+{
+  return parse_new_pack (pack_str, SIZE_MAX, AMIPACK_HEAP, NULL);
+}
+
+AMIPacket *amiparse_pack_view (const char *pack_str)
+{
+  return parse_new_pack (pack_str, SIZE_MAX, AMIPACK_VIEW, NULL);
+}
+
+AMIPacket *amiparse_pack_n (const char *buf, size_t len, enum pack_mode mode)
+{
+  return parse_new_pack (buf, len, mode, NULL);
+}
+
+AMIPacket *amiparse_pack_select (const char *buf, size_t len,
+                                 enum pack_mode mode, const AMIHdrSet *wanted)
+{
+  return parse_new_pack (buf, len, mode, wanted);
+}
+
+AMIPacket *amiparse_pack_pool (AMIPackPool *pool, const char *buf, size_t len)
+{
+  AMIPacket *pack = amipool_get (pool);
+
+  if (pack == NULL)
+    return NULL;
+
+  if (parse_pack (pack, buf, len, NULL) != RV_SUCCESS) {
+    amipool_put (pool, pack);
+    return NULL;
+  }
+  return pack;
+}
+
+int amiparse_pack_to (AMIPacket *pack, const char *buf, size_t len)
+{
+  if (pack->size || amipack_shared (pack))
+    return RV_FAIL;
+
+  return parse_pack (pack, buf, len, NULL);
+}
@@ -0,0 +1,318 @@
+/**
+ * libamip -- Library with functions for read/create AMI packets
+ * Copyright (C) 2016, Stas Kobzar <staskobzar@modulis.ca>
+ *
+ * This file is part of libamip.
+ *
+ * libamip is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * libamip is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with libamip.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/**
+ * @file parse_stream.c
+ * @brief AMI (Asterisk Management Interface) stream parser.
+ * Collects bytes chunks received from server, frames packets and
+ * parses every complete packet with packet parser. Packet scanner is
+ * generated without re2c storable state, so it needs whole packet and
+ * can not continue from the end of chunk: only the search for packet
+ * end is resumed between chunks.
+ *
+ * @author Stas Kobzar <stas.kobzar@modulis.ca>
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "amip.h"
+
+/*! Initial size of stream buffer. */
+#define STREAM_BUF_SIZE 4096
+
+/*! AMI prompt line prefix. */
+#define PROMPT_PREFIX "Asterisk Call Manager/"
+
+/*! AMI prompt line prefix length. */
+#define PROMPT_PREFIX_LEN (sizeof(PROMPT_PREFIX) - 1)
+
+/*! Stream prompt line states. */
+enum stream_prompt {
+  PROMPT_WAIT,  /*!< Stream start, prompt line is expected. */
+  PROMPT_DONE,  /*!< Prompt line is parsed or stream has no prompt line. */
+};
+
+/*! Event header name. */
+#define EVENT_PREFIX "Event:"
+
+/*! Event header name length. */
+#define EVENT_PREFIX_LEN (sizeof(EVENT_PREFIX) - 1)
+
+/*! Number of packets ends searched at once by batch parser. */
+#define BATCH_FRAMES 32
+
+/**
+ * Find end of the packet: "\r\n\r\n" bytes sequence.
+ * @param p       Bytes array to search
+ * @param end     End of bytes array
+ * @return pointer to the first byte after stanza or NULL if not found.
+ */
+static const char *stanza_end (const char *p, const char *end)
+{
+  size_t off;
+
+  if (amiparse_frames (p, end - p, &off, 1) == 0)
+    return NULL;
+  return p + off;
+}
+
+/**
+ * Create empty packet for stream or take it from stream pool.
+ * @param stream    AMI stream structure pointer
+ * @return AMIPacket pointer or NULL if memory allocation failed.
+ */
+static AMIPacket *stream_pack (AMIStream *stream)
+{
+  if (stream->pool)
+    return amipool_get (stream->pool);
+  return amipack_init_mode (stream->mode);
+}
+
+/**
+ * Destroy packet that is not emitted or return it to stream pool.
+ * @param stream    AMI stream structure pointer
+ * @param pack      AMI packet created by stream_pack
+ */
+static void stream_release (AMIStream *stream, AMIPacket *pack)
+{
+  if (stream->pool)
+    amipool_put (stream->pool, pack);
+  else
+    amipack_destroy (pack);
+}
+
+/**
+ * Parse prompt line at stream start.
+ * @param stream    AMI stream structure pointer
+ * @return AMI_PROMPT packet, NULL if more bytes are needed or
+ *         stream does not start with prompt line.
+ */
+static AMIPacket *stream_prompt (AMIStream *stream)
+{
+  const char *p = stream->buf + stream->start;
+  size_t len = stream->len - stream->start;
+  const char *eol;
+  AMIPacket *pack;
+
+  if (memcmp (p, PROMPT_PREFIX, len < PROMPT_PREFIX_LEN ? len : PROMPT_PREFIX_LEN) != 0) {
+    stream->prompt = PROMPT_DONE;
+    return NULL;
+  }
+
+  if (len < PROMPT_PREFIX_LEN || (eol = memchr (p, '\n', len)) == NULL)
+    return NULL;
+
+  // prompt line stays in stream until packet is allocated
+  pack = stream_pack (stream);
+  if (pack == NULL) {
+    stream->enomem++;
+    return NULL;
+  }
+
+  stream->prompt = PROMPT_DONE;
+  stream->start += eol - p + 1;
+  stream->scan = stream->start;
+
+  if (amiparse_prompt (p, &stream->version) != RV_SUCCESS) {
+    stream_release (stream, pack);
+    stream->errors++;
+    return NULL;
+  }
+
+  amipack_type (pack, AMI_PROMPT);
+  return pack;
+}
+
+enum event_type amiparse_event (const char *buf, size_t len)
+{
+  const char *p = buf + EVENT_PREFIX_LEN, *end = buf + len, *eol;
+
+  if (len < EVENT_PREFIX_LEN || strncasecmp (buf, EVENT_PREFIX, EVENT_PREFIX_LEN) != 0)
+    return EVENT_UNKNOWN;
+
+  while (p < end && *p == ' ')
+    p++;
+
+  eol = memchr (p, '\r', end - p);
+  if (eol == NULL)
+    return EVENT_UNKNOWN;
+
+  return event_type_id (p, eol - p);
+}
+
+AMIStream *amistream_init (enum pack_mode mode)
+{
+  AMIStream *stream = (AMIStream *) amialloc (sizeof (AMIStream));
+  if (stream == NULL)
+    return NULL;
+
+  stream->buf = NULL;
+  stream->len = 0;
+  stream->size = 0;
+  stream->start = 0;
+  stream->scan = 0;
+  stream->mode = mode;
+  stream->prompt = PROMPT_WAIT;
+  stream->version.major = 0;
+  stream->version.minor = 0;
+  stream->version.patch = 0;
+  stream->errors = 0;
+  stream->skip = NULL;
+  stream->pool = NULL;
+  stream->skipped = 0;
+  stream->enomem = 0;
+
+  return stream;
+}
+
+void amistream_destroy (AMIStream *stream)
+{
+  if (stream) {
+    amifree (stream->buf);
+    amifree (stream);
+  }
+}
+
+int amistream_feed (AMIStream *stream, const char *data, size_t len)
+{
+  // drop bytes of emitted packets
+  if (stream->start > 0) {
+    stream->len -= stream->start;
+    stream->scan -= stream->start;
+    memmove (stream->buf, stream->buf + stream->start, stream->len);
+    stream->start = 0;
+  }
+
+  if (stream->len + len > stream->size) {
+    size_t size = stream->size ? stream->size : STREAM_BUF_SIZE;
+    char *buf;
+
+    while (size < stream->len + len)
+      size *= 2;
+
+    buf = (char *) amirealloc (stream->buf, size);
+    if (buf == NULL)
+      return RV_FAIL;
+    stream->buf = buf;
+    stream->size = size;
+  }
+
+  memcpy (stream->buf + stream->len, data, len);
+  stream->len += len;
+
+  return RV_SUCCESS;
+}
+
+void amistream_skip (AMIStream *stream, const AMIEventSet *skip)
+{
+  stream->skip = skip;
+}
+
+void amistream_pool (AMIStream *stream, AMIPackPool *pool)
+{
+  stream->pool = pool;
+}
+
+AMIPacket *amistream_next (AMIStream *stream)
+{
+  const char *from, *pend;
+  AMIPacket *pack;
+  int rv;
+
+  if (stream->prompt == PROMPT_WAIT && stream->len > stream->start) {
+    pack = stream_prompt (stream);
+    if (pack || stream->prompt == PROMPT_WAIT)
+      return pack;
+  }
+
+  while (stream->len - stream->start > 0) {
+    // continue search where previous one stopped,
+    // stanza may be split between chunks
+    from = stream->buf + (stream->scan >= stream->start + 3 ? stream->scan - 3 : stream->start);
+    pend = stanza_end (from, stream->buf + stream->len);
+    if (pend == NULL) {
+      stream->scan = stream->len;
+      return NULL;
+    }
+
+    from = stream->buf + stream->start;
+
+    if (stream->skip &&
+        amihdrset_has (stream->skip, amiparse_event (from, pend - from))) {
+      stream->start = pend - stream->buf;
+      stream->scan = stream->start;
+      stream->skipped++;
+      continue;
+    }
+
+    // packet that failed to allocate stays in stream for next call
+    pack = stream_pack (stream);
+    rv = pack ? amiparse_pack_to (pack, from, pend - from) : RV_ENOMEM;
+    if (rv == RV_ENOMEM) {
+      if (pack)
+        stream_release (stream, pack);
+      stream->enomem++;
+      return NULL;
+    }
+
+    stream->start = pend - stream->buf;
+    stream->scan = stream->start;
+    if (rv == RV_SUCCESS)
+      return pack;
+    stream_release (stream, pack);
+    stream->errors++;
+  }
+
+  return NULL;
+}
+
+int amiparse_batch (const char *buf, size_t len, enum pack_mode mode,
+                    AMIPackPool *pool, AMIPacket **packs, int max, size_t *consumed)
+{
+  size_t ends[BATCH_FRAMES];
+  size_t pos = 0, base;
+  int n = 0, found, rv = RV_SUCCESS;
+  AMIPacket *pack;
+
+  while (n < max && rv != RV_ENOMEM &&
+         (found = amiparse_frames (buf + pos, len - pos, ends, BATCH_FRAMES)) > 0) {
+    base = pos;
+    for (int i = 0; i < found && n < max; i++) {
+      pack = pool ? amipool_get (pool) : amipack_init_mode (mode);
+      rv = pack ? amiparse_pack_to (pack, buf + pos, base + ends[i] - pos) : RV_ENOMEM;
+      if (rv == RV_SUCCESS)
+        packs[n++] = pack;
+      else if (pack && pool)
+        amipool_put (pool, pack);
+      else if (pack)
+        amipack_destroy (pack);
+      // packet that failed to allocate is not consumed
+      if (rv == RV_ENOMEM)
+        break;
+      pos = base + ends[i];
+    }
+  }
+
+  if (consumed)
+    *consumed = pos;
+
+  return n == 0 && rv == RV_ENOMEM ? -1 : n;
+}
@@ -4,6 +4,8 @@
 #include <cmocka.h>
 
 #include <stdio.h>
+#include <limits.h>
+#include <unistd.h>
 #include "amip.h"
 
 static int setup_pack(void **state)
@@ -265,6 +267,495 @@ static void pack_find_header_by_name (void **state)
 
 }
 
+static void pack_event_action_types (void **state)
+{
+  AMIPacket *pack = *state;
+
+  assert_int_equal (amipack_event(pack), EVENT_UNKNOWN);
+  assert_int_equal (amipack_action(pack), ACTION_UNKNOWN);
+
+  amipack_type(pack, AMI_ACTION);
+  amipack_append (pack, Action, "originate");
+  amipack_append (pack, Channel, "SIP/1001");
+  assert_int_equal (amipack_action(pack), Originate);
+  assert_int_equal (amipack_event(pack), EVENT_UNKNOWN);
+
+  // every event and action name is found
+  for (int i = EVENT_UNKNOWN + 1; i <= IdentifyDetail; i++) {
+    const char *name = event_name (i);
+    assert_int_equal (event_type_id (name, strlen (name)), i);
+  }
+  for (int i = ACTION_UNKNOWN + 1; i <= WaitEvent; i++) {
+    const char *name = action_name (i);
+    assert_int_equal (action_type_id (name, strlen (name)), i);
+  }
+
+  assert_int_equal (event_type_id ("Newexten", 8), NewExten);
+  assert_int_equal (event_type_id ("Hangups", 7), EVENT_UNKNOWN);
+  assert_int_equal (event_type_id ("Hangup", 5), EVENT_UNKNOWN);
+  assert_int_equal (event_type_id ("", 0), EVENT_UNKNOWN);
+  assert_string_equal (event_name (HangupEvent), "Hangup");
+  assert_string_equal (action_name (-1), "ACTION_UNKNOWN");
+}
+
+static void create_pack_arena (void **state)
+{
+  (void)*state;
+  struct str *pack_str;
+  struct str *hv; // header value
+  char value[64];
+  AMIPacket *pack = amipack_init_mode (AMIPACK_ARENA);
+
+  amipack_type(pack, AMI_ACTION);
+  amipack_append (pack, Action, "Originate");
+  amipack_append_unknown (pack, "X-Custom", "value");
+  amipack_append (pack, Exten, NULL);
+
+  hv = amiheader_value(pack, Action);
+  assert_string_equal (hv->buf, "Originate");
+  hv = amiheader_value_by_hdr_name(pack, "x-custom");
+  assert_string_equal (hv->buf, "value");
+  hv = amiheader_value(pack, Exten);
+  assert_string_equal (hv->buf, "");
+  assert_int_equal (amipack_action(pack), Originate);
+
+  pack_str = amipack_to_str (pack);
+  assert_memory_equal (pack_str->buf, "Action: Originate\r\n"
+                                      "X-Custom: value\r\n"
+                                      "Exten: \r\n\r\n", pack_str->len);
+  assert_int_equal(pack_str->len, amipack_length(pack));
+  str_destroy (pack_str);
+
+  // headers that do not fit in first memory block
+  for (int i = 0; i < 200; i++) {
+    sprintf (value, "%d", i);
+    amipack_append (pack, Variable, value);
+  }
+  assert_int_equal (pack->size, 203);
+  hv = amiheader_value(pack, Variable);
+  assert_string_equal (hv->buf, "0");
+  assert_string_equal (pack->tail->value->buf, "199");
+
+  amipack_destroy (pack);
+}
+
+static void pack_reset_reuse (void **state)
+{
+  AMIPacket *pack = *state;
+  struct str *pack_str;
+
+  amipack_type(pack, AMI_ACTION);
+  amipack_append (pack, Action, "Ping");
+  amipack_append_unknown (pack, "X-Custom", "value");
+  amipack_reset (pack);
+
+  assert_int_equal (pack->size, 0);
+  assert_int_equal (pack->type, AMI_UNKNOWN);
+  assert_int_equal (amipack_action(pack), ACTION_UNKNOWN);
+  assert_null (amiheader_value(pack, Action));
+  assert_null (amipack_to_str(pack));
+  assert_false (amipack_has_header(pack, Action));
+
+  amipack_type(pack, AMI_ACTION);
+  amipack_append (pack, Action, "Logoff");
+  pack_str = amipack_to_str (pack);
+  assert_memory_equal (pack_str->buf, "Action: Logoff\r\n\r\n", pack_str->len);
+  assert_int_equal(pack_str->len, amipack_length(pack));
+  str_destroy (pack_str);
+}
+
+static void pack_pool_reuse (void **state)
+{
+  (void)*state;
+  AMIPackPool *pool = amipool_init (AMIPACK_ARENA, 1);
+  AMIPacket *pack, *pack2;
+  struct str *hv; // header value
+
+  pack = amipool_get (pool);
+  assert_int_equal (pack->mode, AMIPACK_ARENA);
+  for (int i = 0; i < 300; i++)
+    amipack_append (pack, Variable, "some variable value");
+  amipool_put (pool, pack);
+  assert_int_equal (pool->len, 1);
+  assert_non_null (pack->spare);
+
+  // same packet and memory are reused
+  pack2 = amipool_get (pool);
+  assert_ptr_equal (pack, pack2);
+  assert_int_equal (pack2->size, 0);
+  amipack_append (pack2, Channel, "SIP/1001");
+  hv = amiheader_value(pack2, Channel);
+  assert_string_equal (hv->buf, "SIP/1001");
+  assert_null (amiheader_value(pack2, Variable));
+
+  // pool is full: second packet is destroyed
+  pack = amipool_get (pool);
+  assert_true (pack != pack2);
+  amipool_put (pool, pack2);
+  amipool_put (pool, pack);
+  assert_int_equal (pool->len, 1);
+
+  amipool_destroy (pool);
+}
+
+static void header_inline_strings (void **state)
+{
+  (void)*state;
+  char long_value[128];
+  AMIHeader *hdr;
+
+  // short name and value are stored in header
+  hdr = amiheader_create (HDR_UNKNOWN, "X-Custom", "from-internal");
+  assert_string_equal (hdr->name->buf, "X-Custom");
+  assert_string_equal (hdr->value->buf, "from-internal");
+  assert_int_equal (hdr->flags, 0);
+  assert_true (hdr->value->buf >= hdr->inl && hdr->value->buf < hdr->inl + AMIHDR_INLINE_SIZE);
+  assert_true (hdr->name->buf >= hdr->inl && hdr->name->buf < hdr->inl + AMIHDR_INLINE_SIZE);
+  amiheader_destroy (hdr);
+
+  // long value is copied to heap
+  memset (long_value, 'a', sizeof(long_value) - 1);
+  long_value[sizeof(long_value) - 1] = '\0';
+  hdr = amiheader_create (Variable, "Variable", long_value);
+  assert_int_equal (hdr->flags, AMIHDR_VALUE_HEAP);
+  assert_int_equal (hdr->value->len, sizeof(long_value) - 1);
+  assert_string_equal (hdr->value->buf, long_value);
+  assert_string_equal (hdr->name->buf, "Variable");
+  amiheader_destroy (hdr);
+
+  // known header type name is not copied
+  hdr = amiheader_create (Channel, header_name (Channel), "SIP/1001");
+  assert_ptr_equal (hdr->name->buf, header_name (Channel));
+  assert_int_equal (hdr->name->len, 7);
+  amiheader_destroy (hdr);
+
+  hdr = amiheader_create (HDR_UNKNOWN, NULL, NULL);
+  assert_int_equal (hdr->name->len, 0);
+  assert_string_equal (hdr->value->buf, "");
+  amiheader_destroy (hdr);
+}
+
+static void pack_headers_types_array (void **state)
+{
+  AMIPacket *pack = *state;
+  struct str *hv; // header value
+  char value[16];
+
+  amipack_type(pack, AMI_EVENT);
+  amipack_append (pack, Event, "CoreShowChannel");
+  for (int i = 0; i < 100; i++) {
+    sprintf (value, "var%d", i);
+    amipack_append (pack, Variable, value);
+  }
+  amipack_append_unknown (pack, "Linkedid", "1486254977.6071371");
+  amipack_append (pack, Uniqueid, "1486254977.6071372");
+
+  assert_int_equal (pack->size, 103);
+  assert_int_equal (pack->types[0], Event);
+  assert_int_equal (pack->types[50], Variable);
+  assert_int_equal (pack->types[101], HDR_UNKNOWN);
+  assert_int_equal (pack->types[102], Uniqueid);
+
+  hv = amiheader_value(pack, Variable);
+  assert_string_equal (hv->buf, "var0");
+  hv = amiheader_value(pack, Uniqueid);
+  assert_string_equal (hv->buf, "1486254977.6071372");
+  hv = amiheader_value_by_hdr_name(pack, "linkedid");
+  assert_string_equal (hv->buf, "1486254977.6071371");
+  assert_null (amiheader_value(pack, Channel));
+
+  // presence index
+  assert_true (amipack_has_header(pack, Event));
+  assert_true (amipack_has_header(pack, Variable));
+  assert_true (amipack_has_header(pack, HDR_UNKNOWN));
+  assert_false (amipack_has_header(pack, Channel));
+  assert_false (amipack_has_header(pack, 1024));
+  assert_int_equal (pack->first[Variable], 1);
+  assert_int_equal (pack->first[Uniqueid], 102);
+}
+
+static void pack_headers_names_index (void **state)
+{
+  AMIPacket *pack = *state;
+  struct str *hv; // header value
+  char name[16], value[16];
+
+  amipack_type(pack, AMI_ACTION);
+  amipack_append (pack, Action, "Originate");
+  amipack_append_unknown (pack, "X-Custom", "first");
+  amipack_append_unknown (pack, "x-custom", "second");
+
+  // index is built on first search
+  assert_null (pack->names);
+  hv = amiheader_value_by_hdr_name(pack, "X-CUSTOM");
+  assert_string_equal (hv->buf, "first");
+  assert_non_null (pack->names);
+  assert_int_equal (pack->names_len, 3);
+  assert_null (amiheader_value_by_hdr_name(pack, "X-Custo"));
+  assert_null (amiheader_value_by_hdr_name(pack, "X-Custom2"));
+
+  // headers appended after search are indexed on next search
+  for (int i = 0; i < 200; i++) {
+    sprintf (name, "X-Var%d", i);
+    sprintf (value, "val%d", i);
+    amipack_append_unknown (pack, name, value);
+  }
+  hv = amiheader_value_by_hdr_name(pack, "x-var150");
+  assert_string_equal (hv->buf, "val150");
+  assert_int_equal (pack->names_len, 203);
+  assert_true (pack->names_size >= 2 * 203);
+  hv = amiheader_value_by_hdr_name(pack, "action");
+  assert_string_equal (hv->buf, "Originate");
+  hv = amiheader_value_by_hdr_name(pack, "x-custom");
+  assert_string_equal (hv->buf, "first");
+
+  // reset packet keeps index memory
+  amipack_reset (pack);
+  assert_null (amiheader_value_by_hdr_name(pack, "Action"));
+  amipack_append_unknown (pack, "X-Var1", "new");
+  hv = amiheader_value_by_hdr_name(pack, "X-Var1");
+  assert_string_equal (hv->buf, "new");
+  assert_null (amiheader_value_by_hdr_name(pack, "X-Var2"));
+}
+
+static void pack_iterate_many_headers (void **state)
+{
+  (void)*state;
+  AMIPacket *pack = amipack_init_mode (AMIPACK_VIEW);
+  AMIHdrIter iter;
+  struct str *hv, *last = NULL; // header value
+  int n = 0;
+
+  // links are kept only for first headers, the rest is scanned
+  for (int i = 0; i < 70000; i++)
+    amipack_append_n (pack, i % 2 ? Variable : Value, NULL, 0, i % 2 ? "v" : "x", 1);
+  amipack_append_n (pack, Exten, NULL, 0, "1002", 4);
+  amipack_append_n (pack, Variable, NULL, 0, "last", 4);
+  assert_int_equal (pack->size, 70002);
+
+  for (amiheader_iter (&iter, pack, Variable); (hv = amiheader_iter_next (&iter)); n++)
+    last = hv;
+  assert_int_equal (n, 35001);
+  assert_memory_equal (last->buf, "last", last->len);
+
+  amiheader_iter (&iter, pack, Exten);
+  hv = amiheader_iter_next (&iter);
+  assert_memory_equal (hv->buf, "1002", hv->len);
+  assert_null (amiheader_iter_next (&iter));
+
+  amipack_destroy (pack);
+}
+
+static void pack_write_buffer (void **state)
+{
+  AMIPacket *pack = *state;
+  char buf[128];
+  size_t len;
+
+  const char str_pack[] = "Action: Originate\r\n"
+                          "Channel: SIP/1001\r\n"
+                          "X-Custom: 1\r\n\r\n";
+
+  assert_int_equal (amipack_write (pack, buf, sizeof(buf)), 0);
+
+  amipack_type(pack, AMI_ACTION);
+  amipack_append (pack, Action, "Originate");
+  amipack_append (pack, Channel, "SIP/1001");
+  amipack_append_unknown (pack, "X-Custom", "1");
+
+  // buffer too small: required size is returned, nothing is written
+  memset (buf, '-', sizeof(buf));
+  len = amipack_write (pack, buf, 10);
+  assert_int_equal (len, sizeof(str_pack) - 1);
+  assert_int_equal (buf[0], '-');
+
+  len = amipack_write (pack, buf, len);
+  assert_int_equal (len, sizeof(str_pack) - 1);
+  assert_memory_equal (buf, str_pack, len);
+  assert_int_equal (buf[len], '-');
+}
+
+static void pack_write_iovec (void **state)
+{
+  AMIPacket *pack = *state;
+  struct iovec iov[16];
+  char buf[128];
+  size_t len = 0;
+  int n;
+
+  const char str_pack[] = "Action: Originate\r\n"
+                          "Variable: var1=a-long-value-not-copied-inline\r\n"
+                          "Variable: var2=b\r\n\r\n";
+
+  assert_int_equal (amipack_iovec_len (pack), 0);
+  assert_int_equal (amipack_iovec (pack, iov, 16), 0);
+
+  amipack_type(pack, AMI_ACTION);
+  amipack_append (pack, Action, "Originate");
+  amipack_append (pack, Variable, "var1=a-long-value-not-copied-inline");
+  amipack_append (pack, Variable, "var2=b");
+
+  assert_int_equal (amipack_iovec_len (pack), 13);
+  assert_int_equal (amipack_iovec (pack, iov, 12), 13);
+
+  n = amipack_iovec (pack, iov, 16);
+  assert_int_equal (n, 13);
+  // values are not copied
+  assert_ptr_equal (iov[6].iov_base, pack->head->next->value->buf);
+  for (int i = 0; i < n; i++) {
+    memcpy (buf + len, iov[i].iov_base, iov[i].iov_len);
+    len += iov[i].iov_len;
+  }
+  assert_int_equal (len, sizeof(str_pack) - 1);
+  assert_memory_equal (buf, str_pack, len);
+}
+
+static void pack_action_template (void **state)
+{
+  AMIPacket *pack = *state;
+  AMITemplate *tmpl;
+  AMIHdrSet vars;
+  char buf[256];
+  size_t len;
+  const char *values[] = { "SIP/1001", "1002", "42" };
+  const char *empty[] = { NULL, "", NULL };
+
+  const char str_pack[] = "Action: Originate\r\n"
+                          "Channel: SIP/1001\r\n"
+                          "Context: default\r\n"
+                          "Exten: 1002\r\n"
+                          "Priority: 1\r\n"
+                          "ActionID: 42\r\n\r\n";
+  const char str_empty[] = "Action: Originate\r\n"
+                           "Channel: \r\n"
+                           "Context: default\r\n"
+                           "Exten: \r\n"
+                           "Priority: 1\r\n"
+                           "ActionID: \r\n\r\n";
+
+  amihdrset_clear (&vars);
+  amihdrset_add (&vars, Channel);
+  amihdrset_add (&vars, Exten);
+  amihdrset_add (&vars, ActionID);
+  assert_null (amitmpl_create (pack, &vars));
+
+  amipack_type(pack, AMI_ACTION);
+  amipack_append (pack, Action, "Originate");
+  amipack_append (pack, Channel, "placeholder");
+  amipack_append (pack, Context, "default");
+  amipack_append (pack, Exten, "");
+  amipack_append (pack, Priority, "1");
+  amipack_append (pack, ActionID, "");
+
+  tmpl = amitmpl_create (pack, &vars);
+  assert_non_null (tmpl);
+  assert_int_equal (tmpl->size, 3);
+
+  assert_int_equal (amitmpl_write (tmpl, values, buf, 10), sizeof(str_pack) - 1);
+  len = amitmpl_write (tmpl, values, buf, sizeof(buf));
+  assert_int_equal (len, sizeof(str_pack) - 1);
+  assert_memory_equal (buf, str_pack, len);
+
+  len = amitmpl_write (tmpl, empty, buf, sizeof(buf));
+  assert_int_equal (len, sizeof(str_empty) - 1);
+  assert_memory_equal (buf, str_empty, len);
+
+  amitmpl_destroy (tmpl);
+}
+
+static void pack_batch_writer (void **state)
+{
+  AMIPacket *pack = *state;
+  AMIWriter *writer;
+  AMITemplate *tmpl;
+  AMIHdrSet vars;
+  char buf[256];
+  int fds[2];
+  const char *values[] = { "SIP/1002" };
+
+  const char str_pack[] = "Action: Hangup\r\n"
+                          "Channel: SIP/1001\r\n\r\n"
+                          "Action: Hangup\r\n"
+                          "Channel: SIP/1002\r\n\r\n";
+
+  amipack_type(pack, AMI_ACTION);
+  amipack_append (pack, Action, "Hangup");
+  amipack_append (pack, Channel, "SIP/1001");
+  amihdrset_clear (&vars);
+  amihdrset_add (&vars, Channel);
+  tmpl = amitmpl_create (pack, &vars);
+
+  writer = amiwriter_init ();
+  assert_non_null (writer);
+
+  // packets are appended back to back, buffer grows
+  for (int i = 0; i < 200; i++) {
+    assert_int_equal (amiwriter_pack (writer, pack), RV_SUCCESS);
+    assert_int_equal (amiwriter_tmpl (writer, tmpl, values), RV_SUCCESS);
+  }
+  assert_int_equal (writer->len, 200 * (sizeof(str_pack) - 1));
+  assert_true (writer->size >= writer->len);
+  assert_memory_equal (writer->buf, str_pack, sizeof(str_pack) - 1);
+  assert_memory_equal (writer->buf + writer->len - sizeof(str_pack) + 1,
+                       str_pack, sizeof(str_pack) - 1);
+
+  amiwriter_clear (writer);
+  amiwriter_pack (writer, pack);
+  amiwriter_tmpl (writer, tmpl, values);
+
+  assert_int_equal (pipe (fds), 0);
+  assert_int_equal (amiwriter_flush (writer, fds[1]), RV_SUCCESS);
+  assert_int_equal (writer->len, 0);
+  assert_int_equal (read (fds[0], buf, sizeof(buf)), sizeof(str_pack) - 1);
+  assert_memory_equal (buf, str_pack, sizeof(str_pack) - 1);
+  close (fds[0]);
+
+  // failed write keeps buffered bytes
+  amiwriter_pack (writer, pack);
+  assert_int_equal (amiwriter_flush (writer, fds[0]), RV_FAIL);
+  assert_int_equal (writer->len, 37);
+  close (fds[1]);
+
+  amiwriter_destroy (writer);
+  amitmpl_destroy (tmpl);
+}
+
+static void pack_builder (void **state)
+{
+  (void)*state;
+  AMIBuilder build;
+  char buf[256], small[16], str_pack[256];
+  size_t len;
+
+  sprintf (str_pack, "Action: QueuePause\r\n"
+                     "ActionID: %lu\r\n"
+                     "Interface: SIP/1001\r\n"
+                     "Paused: \r\n"
+                     "Penalty: %ld\r\n"
+                     "Priority: 0\r\n"
+                     "Timeout: 30000\r\n\r\n", ULONG_MAX, LONG_MIN);
+
+  amibuild_begin (&build, buf, sizeof(buf));
+  assert_int_equal (amibuild_header (&build, Action, "QueuePause"), RV_SUCCESS);
+  assert_int_equal (amibuild_uint (&build, ActionID, ULONG_MAX), RV_SUCCESS);
+  amibuild_unknown (&build, "Interface", "SIP/1001");
+  assert_int_equal (amibuild_header (&build, Paused, NULL), RV_SUCCESS);
+  assert_int_equal (amibuild_int (&build, Penalty, LONG_MIN), RV_SUCCESS);
+  assert_int_equal (amibuild_int (&build, Priority, 0), RV_SUCCESS);
+  assert_int_equal (amibuild_int (&build, Timeout, 30000), RV_SUCCESS);
+  assert_int_equal (amibuild_header (&build, 1024, "x"), -1);
+  assert_int_equal (amibuild_int (&build, HDR_UNKNOWN, 1), -1);
+  len = amibuild_end (&build);
+  assert_int_equal (len, strlen (str_pack));
+  assert_memory_equal (buf, str_pack, len);
+
+  // small buffer: required size is returned
+  amibuild_begin (&build, small, sizeof(small));
+  amibuild_header (&build, Action, "QueuePause");
+  amibuild_unknown (&build, "Interface", "SIP/1001");
+  assert_int_equal (amibuild_end (&build), 43);
+}
+
 int main(void)
 {
   const struct CMUnitTest tests[] = {
@@ -279,6 +770,19 @@ int main(void)
     cmocka_unit_test_setup_teardown (create_pack_with_empty_last_header, setup_pack, teardown_pack),
     cmocka_unit_test_setup_teardown (pack_find_headers, setup_pack, teardown_pack),
     cmocka_unit_test_setup_teardown (pack_find_header_by_name, setup_pack, teardown_pack),
+    cmocka_unit_test_setup_teardown (pack_event_action_types, setup_pack, teardown_pack),
+    cmocka_unit_test (create_pack_arena),
+    cmocka_unit_test_setup_teardown (pack_reset_reuse, setup_pack, teardown_pack),
+    cmocka_unit_test (pack_pool_reuse),
+    cmocka_unit_test (header_inline_strings),
+    cmocka_unit_test_setup_teardown (pack_headers_types_array, setup_pack, teardown_pack),
+    cmocka_unit_test_setup_teardown (pack_headers_names_index, setup_pack, teardown_pack),
+    cmocka_unit_test (pack_iterate_many_headers),
+    cmocka_unit_test_setup_teardown (pack_write_buffer, setup_pack, teardown_pack),
+    cmocka_unit_test_setup_teardown (pack_write_iovec, setup_pack, teardown_pack),
+    cmocka_unit_test_setup_teardown (pack_action_template, setup_pack, teardown_pack),
+    cmocka_unit_test_setup_teardown (pack_batch_writer, setup_pack, teardown_pack),
+    cmocka_unit_test (pack_builder),
   };
 
   cmocka_set_message_output(CM_OUTPUT_TAP);
@@ -392,6 +392,10 @@ static void parse_pack_with_invalid_header (void **state)
 
   assert_null(amiparse_pack (str_pack));
 
+  // header without name
+  assert_null (amiparse_pack_n (": v\r\nExten: 1\r\n\r\n", 17, AMIPACK_VIEW));
+  assert_null (amiparse_pack_n (":\r\n\r\n", 5, AMIPACK_LAZY));
+  assert_null (amiparse_pack_n (": \r\nExten: 1\r\n\r\n", 16, AMIPACK_HEAP));
 }
 
 static void parse_pack_command_output (void **state)
@@ -503,6 +507,1139 @@ static void parse_pack_with_multiple_unknown_headers (void **state)
   amipack_destroy (pack);
 }
 
+static void parse_pack_view (void **state)
+{
+  (void)*state;
+  AMIPacket *pack;
+  struct str *hv; // header value
+  struct str *pack_str;
+
+  const char str_pack[] = "Event: Hangup\r\n"
+                          "Privilege: call,all\r\n"
+                          "Channel: SIP/ipauthTp3BCHH7-00573401\r\n"
+                          "Linkedid: 1486254977.6071371\r\n"
+                          "Exten: \r\n"
+                          "Cause-txt: Normal Clearing\r\n\r\n";
+
+  pack = amiparse_pack_view (str_pack);
+  assert_non_null (pack);
+  assert_int_equal (AMI_EVENT, pack->type);
+  assert_int_equal (AMIPACK_VIEW, pack->mode);
+  assert_int_equal (pack->size, 6);
+  assert_int_equal (amipack_length(pack), sizeof(str_pack) - 1);
+
+  // values point to parsed buffer
+  hv = amiheader_value(pack, Channel);
+  assert_int_equal (hv->len, 27);
+  assert_memory_equal (hv->buf, "SIP/ipauthTp3BCHH7-00573401", hv->len);
+  assert_true (hv->buf > str_pack && hv->buf < str_pack + sizeof(str_pack));
+
+  hv = amiheader_value(pack, Exten);
+  assert_int_equal (hv->len, 0);
+
+  hv = amiheader_value(pack, Cause_txt);
+  assert_int_equal (hv->len, 15);
+  assert_memory_equal (hv->buf, "Normal Clearing", hv->len);
+
+  hv = amiheader_value_by_hdr_name(pack, "linkedid");
+  assert_int_equal (hv->len, 18);
+  assert_memory_equal (hv->buf, "1486254977.6071371", hv->len);
+  assert_null (amiheader_value_by_hdr_name(pack, "Linked"));
+
+  pack_str = amipack_to_str(pack);
+  assert_int_equal (pack_str->len, sizeof(str_pack) - 1);
+  assert_memory_equal (pack_str->buf, str_pack, pack_str->len);
+
+  str_destroy(pack_str);
+  amipack_destroy (pack);
+}
+
+static void parse_pack_lazy (void **state)
+{
+  (void)*state;
+  AMIPacket *pack;
+  char *buf;
+  struct str *hv; // header value
+  struct str *pack_str;
+  int n = 0;
+
+  const char str_pack[] = "Event: Newchannel\r\n"
+                          "Privilege: call,all\r\n"
+                          "Channel: SIP/1001-0000002a\r\n"
+                          "ChannelState: 0\r\n"
+                          "Linkedid: 1486256739.6071687\r\n"
+                          "Uniqueid: 1486256739.6071687\r\n\r\n";
+
+  pack = amiparse_pack_n (str_pack, sizeof(str_pack) - 1, AMIPACK_LAZY);
+  assert_non_null (pack);
+  assert_int_equal (AMI_EVENT, pack->type);
+  assert_int_equal (AMIPACK_LAZY, pack->mode);
+  assert_int_equal (pack->size, 6);
+  assert_int_equal (amipack_length(pack), sizeof(str_pack) - 1);
+  assert_null (pack->head);
+
+  hv = amiheader_value(pack, Channel);
+  assert_int_equal (hv->len, 17);
+  assert_memory_equal (hv->buf, "SIP/1001-0000002a", hv->len);
+  assert_true (hv->buf > str_pack && hv->buf < str_pack + sizeof(str_pack));
+  assert_ptr_equal (hv, amiheader_value(pack, Channel));
+
+  hv = amiheader_value_by_hdr_name(pack, "linkedid");
+  assert_int_equal (hv->len, 18);
+  assert_memory_equal (hv->buf, "1486256739.6071687", hv->len);
+  assert_null (amiheader_value_by_hdr_name(pack, "Linked"));
+  assert_null (amiheader_value(pack, Cause));
+
+  // lazy packet is written without creating headers
+  buf = malloc (amipack_length(pack));
+  assert_int_equal (amipack_write (pack, buf, amipack_length(pack)), sizeof(str_pack) - 1);
+  assert_memory_equal (buf, str_pack, sizeof(str_pack) - 1);
+  assert_null (pack->head);
+  free (buf);
+
+  // headers list is created on decode, requested headers are reused
+  amipack_decode (pack);
+  assert_int_equal (AMIPACK_VIEW, pack->mode);
+  assert_int_equal (pack->size, 6);
+  for (AMIHeader *hdr = pack->head; hdr; hdr = hdr->next)
+    n++;
+  assert_int_equal (n, 6);
+  assert_ptr_equal (hv, amiheader_value_by_hdr_name(pack, "Linkedid"));
+
+  pack_str = amipack_to_str(pack);
+  assert_int_equal (pack_str->len, sizeof(str_pack) - 1);
+  assert_memory_equal (pack_str->buf, str_pack, pack_str->len);
+
+  str_destroy(pack_str);
+  amipack_destroy (pack);
+}
+
+static void parse_pack_arena (void **state)
+{
+  (void)*state;
+  AMIPacket *pack;
+  struct str *hv; // header value
+  char str_pack[] = "Event: Hangup\r\n"
+                    "Channel: SIP/ipauthTp3BCHH7-00573401\r\n"
+                    "Linkedid: 1486254977.6071371\r\n"
+                    "Cause-txt: Normal Clearing\r\n\r\n";
+
+  pack = amiparse_pack_n (str_pack, sizeof(str_pack) - 1, AMIPACK_ARENA);
+  assert_non_null (pack);
+  assert_int_equal (AMIPACK_ARENA, pack->mode);
+  assert_int_equal (pack->size, 4);
+  assert_int_equal (amipack_length(pack), sizeof(str_pack) - 1);
+
+  // strings are copied to packet memory
+  memset (str_pack, 'x', sizeof(str_pack));
+  hv = amiheader_value(pack, Channel);
+  assert_string_equal (hv->buf, "SIP/ipauthTp3BCHH7-00573401");
+  hv = amiheader_value_by_hdr_name(pack, "Linkedid");
+  assert_string_equal (hv->buf, "1486254977.6071371");
+  assert_string_equal (pack->head->next->next->name->buf, "Linkedid");
+  assert_ptr_equal (pack->head->name->buf, header_name (Event));
+  hv = amiheader_value(pack, Cause_txt);
+  assert_string_equal (hv->buf, "Normal Clearing");
+
+  amipack_destroy (pack);
+}
+
+static void parse_pack_select_headers (void **state)
+{
+  (void)*state;
+  AMIPacket *pack;
+  AMIHdrSet wanted;
+  struct str *hv; // header value
+
+  const char str_pack[] = "Event: Newchannel\r\n"
+                          "Privilege: call,all\r\n"
+                          "Channel: SIP/1001-0000002a\r\n"
+                          "ChannelState: \r\n"
+                          "Linkedid: 1486256739.6071687\r\n"
+                          "Uniqueid: 1486256739.6071687\r\n\r\n";
+
+  amihdrset_clear (&wanted);
+  amihdrset_add (&wanted, Channel);
+  amihdrset_add (&wanted, ChannelState);
+  amihdrset_add (&wanted, Uniqueid);
+
+  pack = amiparse_pack_select (str_pack, sizeof(str_pack) - 1, AMIPACK_HEAP, &wanted);
+  assert_non_null (pack);
+  assert_int_equal (AMI_EVENT, pack->type);
+  assert_int_equal (pack->size, 3);
+  assert_null (amiheader_value(pack, Event));
+  assert_null (amiheader_value(pack, Privilege));
+  assert_null (amiheader_value_by_hdr_name(pack, "Linkedid"));
+
+  hv = amiheader_value(pack, Channel);
+  assert_string_equal (hv->buf, "SIP/1001-0000002a");
+  hv = amiheader_value(pack, ChannelState);
+  assert_int_equal (hv->len, 0);
+  hv = amiheader_value(pack, Uniqueid);
+  assert_string_equal (hv->buf, "1486256739.6071687");
+  amipack_destroy (pack);
+
+  // unknown headers are selected with HDR_UNKNOWN
+  amihdrset_clear (&wanted);
+  amihdrset_add (&wanted, HDR_UNKNOWN);
+  pack = amiparse_pack_select (str_pack, sizeof(str_pack) - 1, AMIPACK_VIEW, &wanted);
+  assert_non_null (pack);
+  assert_int_equal (pack->size, 1);
+  hv = amiheader_value_by_hdr_name(pack, "Linkedid");
+  assert_memory_equal (hv->buf, "1486256739.6071687", hv->len);
+  amipack_destroy (pack);
+
+  // invalid packet still fails
+  pack = amiparse_pack_select (str_pack, 20, AMIPACK_HEAP, &wanted);
+  assert_null (pack);
+}
+
+static void parse_pack_select_command_output (void **state)
+{
+  (void)*state;
+  AMIPacket *pack;
+  AMIHdrSet wanted;
+  struct str *hv; // header value
+
+  const char str_pack[] = "Response: Follows\r\n"
+                          "Privilege: Command\r\n"
+                          "ActionID: 12345\r\n"
+                          "Output: Peer Status\r\n"
+                          "--END COMMAND--\r\n\r\n";
+
+  amihdrset_clear (&wanted);
+  amihdrset_add (&wanted, ActionID);
+  amihdrset_add (&wanted, Output);
+
+  pack = amiparse_pack_select (str_pack, sizeof(str_pack) - 1, AMIPACK_HEAP, &wanted);
+  assert_non_null (pack);
+  assert_int_equal (AMI_RESPONSE, pack->type);
+  assert_int_equal (pack->size, 2);
+  assert_null (amiheader_value(pack, Response));
+  assert_null (amiheader_value(pack, Privilege));
+  hv = amiheader_value(pack, ActionID);
+  assert_string_equal (hv->buf, "12345");
+  hv = amiheader_value(pack, Output);
+  assert_string_equal (hv->buf, "Output: Peer Status\r\n");
+  amipack_destroy (pack);
+}
+
+static void parse_pack_event_action_types (void **state)
+{
+  (void)*state;
+  AMIPacket *pack;
+  AMIHdrSet wanted;
+
+  const char event_pack[] = "Event: Newexten\r\n"
+                            "Channel: SIP/1001-0000002a\r\n\r\n";
+  const char action_pack[] = "Action: Originate\r\n"
+                             "ActionID: 1\r\n\r\n";
+  const char custom_pack[] = "Event: MyCustomEvent\r\n\r\n";
+
+  pack = amiparse_pack (event_pack);
+  assert_int_equal (AMI_EVENT, pack->type);
+  assert_int_equal (amipack_event(pack), NewExten);
+  assert_int_equal (amipack_action(pack), ACTION_UNKNOWN);
+  amipack_destroy (pack);
+
+  pack = amiparse_pack_n (action_pack, sizeof(action_pack) - 1, AMIPACK_LAZY);
+  assert_int_equal (amipack_action(pack), Originate);
+  amipack_destroy (pack);
+
+  pack = amiparse_pack (custom_pack);
+  assert_int_equal (AMI_EVENT, pack->type);
+  assert_int_equal (amipack_event(pack), EVENT_UNKNOWN);
+  amipack_destroy (pack);
+
+  // event type is set even if Event header is not wanted
+  amihdrset_clear (&wanted);
+  amihdrset_add (&wanted, Channel);
+  pack = amiparse_pack_select (event_pack, sizeof(event_pack) - 1, AMIPACK_HEAP, &wanted);
+  assert_int_equal (pack->size, 1);
+  assert_int_equal (amipack_event(pack), NewExten);
+  amipack_destroy (pack);
+}
+
+static void parse_pack_view_command_output (void **state)
+{
+  (void)*state;
+  AMIPacket *pack;
+  struct str *hv; // header value
+
+  const char str_pack[] = "Response: Follows\r\n"
+                          "Privilege: Command\r\n"
+                          "1754093 calls processed\n"
+                          "--END COMMAND--\r\n\r\n";
+
+  pack = amiparse_pack_view (str_pack);
+  assert_non_null (pack);
+  assert_int_equal (AMI_RESPONSE, pack->type);
+
+  hv = amiheader_value(pack, Response);
+  assert_memory_equal (hv->buf, "Follows", hv->len);
+
+  hv = amiheader_value(pack, Privilege);
+  assert_int_equal (hv->len, 7);
+  assert_memory_equal (hv->buf, "Command", hv->len);
+
+  hv = amiheader_value(pack, Output);
+  assert_int_equal (hv->len, 24);
+  assert_memory_equal (hv->buf, "1754093 calls processed\n", hv->len);
+
+  amipack_destroy (pack);
+}
+
+static void parse_pack_view_invalid (void **state)
+{
+  (void)*state;
+  const char str_pack[] = "Event: FullyBooted\r\n"
+                          "invalid header\r\n"
+                          "Exten: \r\n\r\n";
+
+  assert_null (amiparse_pack_view (str_pack));
+}
+
+static void parse_unknown_header_names (void **state)
+{
+  (void)*state;
+  AMIPacket *pack;
+  struct str *hv; // header value
+  const char *str = "Unknown-Header_Name: Unknown AMI Packet\r\n"
+                    "Exten: \r\n"
+                    "SessionID: 0xa134edc\r\n\r\n";
+
+  pack = amiparse_pack (str);
+  assert_non_null (pack);
+  assert_int_equal (pack->size, 3);
+
+  hv = amiheader_value_by_hdr_name(pack, "Unknown-Header_Name");
+  assert_non_null (hv);
+  assert_string_equal (hv->buf, "Unknown AMI Packet");
+
+  hv = amiheader_value_by_hdr_name(pack, "SessionID");
+  assert_non_null (hv);
+  assert_string_equal (hv->buf, "0xa134edc");
+
+  amipack_destroy (pack);
+}
+
+static void parse_pack_n_in_buffer (void **state)
+{
+  (void)*state;
+  AMIPacket *pack;
+  struct str *hv; // header value
+  const char rcv[] = "Event: FullyBooted\r\n"
+                     "Privilege: system,all\r\n\r\n"
+                     "Response: Success\r\n"
+                     "ActionID: 1q2w3e4\r\n\r\n";
+  size_t len1 = 45, len2 = 40;
+  // packets copied to buffer of exact size, no '\0' at the end
+  char *buf = malloc (len1 + len2);
+  memcpy (buf, rcv, len1 + len2);
+
+  pack = amiparse_pack_n (buf, len1, AMIPACK_HEAP);
+  assert_non_null (pack);
+  assert_int_equal (AMI_EVENT, pack->type);
+  assert_int_equal (pack->size, 2);
+  hv = amiheader_value(pack, Privilege);
+  assert_string_equal (hv->buf, "system,all");
+  amipack_destroy (pack);
+
+  pack = amiparse_pack_n (buf + len1, len2, AMIPACK_VIEW);
+  assert_non_null (pack);
+  assert_int_equal (AMI_RESPONSE, pack->type);
+  assert_int_equal (pack->size, 2);
+  hv = amiheader_value(pack, ActionID);
+  assert_int_equal (hv->len, 7);
+  assert_memory_equal (hv->buf, "1q2w3e4", hv->len);
+  amipack_destroy (pack);
+
+  free (buf);
+}
+
+static void parse_pack_n_truncated (void **state)
+{
+  (void)*state;
+  const char rcv[] = "Event: FullyBooted\r\n"
+                     "Privilege: system,all\r\n\r\n";
+  char *buf;
+
+  // packet cut at every position must fail and never read after limit
+  for (size_t len = 0; len < sizeof(rcv) - 1; len++) {
+    buf = malloc (len + 1);
+    memcpy (buf, rcv, len);
+    assert_null (amiparse_pack_n (buf, len, AMIPACK_HEAP));
+    free (buf);
+  }
+
+  // header line without colon
+  buf = malloc (10);
+  memcpy (buf, "Foo\r\n\r\nBar", 10);
+  assert_null (amiparse_pack_n (buf, 7, AMIPACK_VIEW));
+  free (buf);
+}
+
+static void parse_pack_n_command_no_end (void **state)
+{
+  (void)*state;
+  const char rcv[] = "Response: Follows\r\n"
+                     "Privilege: Command\r\n"
+                     "1754093 calls processed\n\r\n\r\n";
+  char *buf = malloc (sizeof(rcv) - 1);
+  memcpy (buf, rcv, sizeof(rcv) - 1);
+
+  assert_null (amiparse_pack_n (buf, sizeof(rcv) - 1, AMIPACK_HEAP));
+
+  free (buf);
+}
+
+static void parse_stream_chunks (void **state)
+{
+  (void)*state;
+  AMIStream *stream;
+  AMIPacket *pack;
+  struct str *hv; // header value
+  const char rcv[] = "Asterisk Call Manager/2.10.3\r\n"
+                     "Response: Success\r\n"
+                     "Message: Authentication accepted\r\n\r\n"
+                     "Event: FullyBooted\r\n"
+                     "Privilege: system,all\r\n\r\n"
+                     "invalid pack that match stanza\r\n\r\n"
+                     "Event: Newchannel\r\n"
+                     "Channel: SIP/1001-0000002a\r\n\r\n"
+                     "Event: Hangup\r\n";
+
+  // every chunk size splits packets at different positions
+  for (size_t chunk = 1; chunk < sizeof(rcv); chunk++) {
+    int n = 0;
+    stream = amistream_init (AMIPACK_HEAP);
+    for (size_t off = 0; off < sizeof(rcv) - 1; off += chunk) {
+      size_t len = sizeof(rcv) - 1 - off < chunk ? sizeof(rcv) - 1 - off : chunk;
+      assert_int_equal (RV_SUCCESS, amistream_feed (stream, rcv + off, len));
+      while ((pack = amistream_next (stream)) != NULL) {
+        switch (n++) {
+          case 0:
+            assert_int_equal (AMI_PROMPT, pack->type);
+            assert_int_equal (2, stream->version.major);
+            assert_int_equal (10, stream->version.minor);
+            assert_int_equal (3, stream->version.patch);
+            break;
+          case 1:
+            assert_int_equal (AMI_RESPONSE, pack->type);
+            hv = amiheader_value(pack, Message);
+            assert_string_equal (hv->buf, "Authentication accepted");
+            break;
+          case 2:
+            assert_int_equal (AMI_EVENT, pack->type);
+            hv = amiheader_value(pack, Event);
+            assert_string_equal (hv->buf, "FullyBooted");
+            break;
+          case 3:
+            hv = amiheader_value(pack, Channel);
+            assert_string_equal (hv->buf, "SIP/1001-0000002a");
+            break;
+        }
+        amipack_destroy (pack);
+      }
+    }
+    assert_int_equal (n, 4);
+    assert_int_equal (stream->errors, 1);
+    // last packet is not complete
+    assert_int_equal (stream->len - stream->start, 15);
+    amistream_destroy (stream);
+  }
+}
+
+static void parse_stream_no_prompt (void **state)
+{
+  (void)*state;
+  AMIStream *stream = amistream_init (AMIPACK_VIEW);
+  AMIPacket *pack;
+  struct str *hv; // header value
+  const char rcv[] = "Event: FullyBooted\r\n\r\n";
+
+  assert_null (amistream_next (stream));
+  amistream_feed (stream, rcv, 5);
+  assert_null (amistream_next (stream));
+  amistream_feed (stream, rcv + 5, sizeof(rcv) - 6);
+
+  pack = amistream_next (stream);
+  assert_non_null (pack);
+  hv = amiheader_value(pack, Event);
+  assert_memory_equal (hv->buf, "FullyBooted", hv->len);
+  assert_null (amistream_next (stream));
+
+  amipack_destroy (pack);
+  amistream_destroy (stream);
+}
+
+static void parse_stream_skip_events (void **state)
+{
+  (void)*state;
+  AMIStream *stream = amistream_init (AMIPACK_VIEW);
+  AMIEventSet skip;
+  AMIPacket *pack;
+  const char rcv[] = "Event: VarSet\r\n"
+                     "Variable: RTPAUDIOQOS\r\n\r\n"
+                     "Event:Newexten\r\n"
+                     "Extension: 1001\r\n\r\n"
+                     "Response: Success\r\n\r\n"
+                     "Event: Hangup\r\n"
+                     "Cause: 16\r\n\r\n"
+                     "event: varset\r\n\r\n";
+
+  assert_int_equal (amiparse_event (rcv, 40), VarSet);
+  assert_int_equal (amiparse_event (rcv + 40, 35), NewExten);
+  assert_int_equal (amiparse_event (rcv + 75, 21), EVENT_UNKNOWN);
+  assert_int_equal (amiparse_event (rcv, 10), EVENT_UNKNOWN);
+
+  amihdrset_clear (&skip);
+  amihdrset_add (&skip, VarSet);
+  amihdrset_add (&skip, NewExten);
+  amistream_skip (stream, &skip);
+  amistream_feed (stream, rcv, sizeof(rcv) - 1);
+
+  pack = amistream_next (stream);
+  assert_int_equal (AMI_RESPONSE, pack->type);
+  amipack_destroy (pack);
+
+  pack = amistream_next (stream);
+  assert_int_equal (amipack_event(pack), HangupEvent);
+  amipack_destroy (pack);
+
+  assert_null (amistream_next (stream));
+  assert_int_equal (stream->skipped, 3);
+  assert_int_equal (stream->errors, 0);
+
+  amistream_destroy (stream);
+}
+
+static void parse_stream_pool_prompt (void **state)
+{
+  (void)*state;
+  AMIStream *stream;
+  AMIPackPool *pool;
+  AMIPacket *pack;
+  char buf[2048];
+  size_t len = 0;
+
+  len += sprintf (buf + len, "Event: UserEvent\r\n");
+  for (int i = 0; i < 40; i++)
+    len += sprintf (buf + len, "Variable: var%d=%d\r\n", i, i);
+  len += sprintf (buf + len, "\r\n");
+
+  // stream packets are taken from pool in any stream mode
+  for (int smode = AMIPACK_HEAP; smode <= AMIPACK_ARENA; smode++) {
+    for (int pmode = AMIPACK_HEAP; pmode <= AMIPACK_ARENA; pmode++) {
+      stream = amistream_init (smode);
+      pool = amipool_init (pmode, 4);
+      amistream_pool (stream, pool);
+
+      assert_int_equal (RV_SUCCESS, amistream_feed (stream, "Asterisk Call Manager/2.10.3\r\n", 30));
+      pack = amistream_next (stream);
+      assert_non_null (pack);
+      assert_int_equal (pack->type, AMI_PROMPT);
+      assert_int_equal (pack->mode, pmode);
+      amipool_put (pool, pack);
+      assert_int_equal (pool->len, 1);
+
+      // packet not taken from pool is destroyed
+      amipool_put (pool, amipack_init_mode ((pmode + 1) % (AMIPACK_ARENA + 1)));
+      assert_int_equal (pool->len, 1);
+
+      assert_int_equal (RV_SUCCESS, amistream_feed (stream, buf, len));
+      pack = amistream_next (stream);
+      assert_non_null (pack);
+      assert_int_equal (pack->size, 41);
+      amipool_put (pool, pack);
+
+      amistream_destroy (stream);
+      amipool_destroy (pool);
+    }
+  }
+}
+
+static void parse_pack_pool_packets (void **state)
+{
+  (void)*state;
+  AMIPackPool *pool = amipool_init (AMIPACK_LAZY, 4);
+  AMIStream *stream = amistream_init (AMIPACK_HEAP);
+  AMIPacket *pack, *first;
+  struct str *hv; // header value
+  const char rcv[] = "Event: Newchannel\r\n"
+                     "Channel: SIP/1001-0000002a\r\n\r\n"
+                     "Event: Hangup\r\n"
+                     "Cause: 16\r\n\r\n";
+
+  pack = amiparse_pack_pool (pool, rcv, 49);
+  assert_non_null (pack);
+  assert_int_equal (amipack_event(pack), Newchannel);
+  amipack_decode (pack);
+  amipool_put (pool, pack);
+  first = pack;
+
+  // invalid packet is returned to pool
+  assert_null (amiparse_pack_pool (pool, "invalid\r\n\r\n", 11));
+  assert_int_equal (pool->len, 1);
+
+  amistream_pool (stream, pool);
+  amistream_feed (stream, rcv, sizeof(rcv) - 1);
+
+  pack = amistream_next (stream);
+  assert_ptr_equal (pack, first);
+  assert_int_equal (pack->mode, AMIPACK_LAZY);
+  assert_int_equal (pack->size, 2);
+  hv = amiheader_value(pack, Channel);
+  assert_memory_equal (hv->buf, "SIP/1001-0000002a", hv->len);
+  amipool_put (pool, pack);
+
+  pack = amistream_next (stream);
+  assert_ptr_equal (pack, first);
+  assert_int_equal (amipack_event(pack), HangupEvent);
+  assert_null (amiheader_value(pack, Channel));
+  hv = amiheader_value(pack, Cause);
+  assert_memory_equal (hv->buf, "16", hv->len);
+  amipool_put (pool, pack);
+
+  amistream_destroy (stream);
+  amipool_destroy (pool);
+}
+
+static void parse_batch_buffer (void **state)
+{
+  (void)*state;
+  AMIPackPool *pool;
+  AMIPacket *packs[4], *first[3];
+  struct str *hv; // header value
+  size_t consumed;
+  int n;
+  const char rcv[] = "Event: Newchannel\r\n"
+                     "Channel: SIP/1001-0000002a\r\n\r\n"
+                     "invalid pack that match stanza\r\n\r\n"
+                     "Event: Newstate\r\n"
+                     "ChannelState: 6\r\n\r\n"
+                     "Event: Hangup\r\n"
+                     "Cause: 16\r\n\r\n"
+                     "Event: Hang";
+
+  n = amiparse_batch (rcv, sizeof(rcv) - 1, AMIPACK_VIEW, NULL, packs, 4, &consumed);
+  assert_int_equal (n, 3);
+  assert_int_equal (consumed, sizeof(rcv) - 1 - 11);
+
+  hv = amiheader_value(packs[0], Channel);
+  assert_memory_equal (hv->buf, "SIP/1001-0000002a", hv->len);
+  hv = amiheader_value(packs[1], ChannelState);
+  assert_memory_equal (hv->buf, "6", hv->len);
+  hv = amiheader_value(packs[2], Cause);
+  assert_memory_equal (hv->buf, "16", hv->len);
+
+  for (int i = 0; i < n; i++)
+    amipack_destroy (packs[i]);
+
+  // stop when packets array is full
+  n = amiparse_batch (rcv, sizeof(rcv) - 1, AMIPACK_HEAP, NULL, packs, 1, &consumed);
+  assert_int_equal (n, 1);
+  assert_int_equal (consumed, 49);
+  amipack_destroy (packs[0]);
+
+  n = amiparse_batch (rcv, 40, AMIPACK_HEAP, NULL, packs, 4, &consumed);
+  assert_int_equal (n, 0);
+  assert_int_equal (consumed, 0);
+
+  // batch packets are taken from pool and reused by next batch
+  pool = amipool_init (AMIPACK_ARENA, 4);
+  n = amiparse_batch (rcv, sizeof(rcv) - 1, AMIPACK_HEAP, pool, packs, 4, &consumed);
+  assert_int_equal (n, 3);
+  assert_int_equal (packs[0]->mode, AMIPACK_ARENA);
+  for (int i = 0; i < n; i++) {
+    first[i] = packs[i];
+    amipool_put (pool, packs[i]);
+  }
+  // invalid packet is returned to pool too
+  assert_int_equal (pool->len, 3);
+
+  n = amiparse_batch (rcv, sizeof(rcv) - 1, AMIPACK_HEAP, pool, packs, 4, &consumed);
+  assert_int_equal (n, 3);
+  assert_int_equal (pool->len, 0);
+  for (int i = 0; i < n; i++)
+    assert_true (packs[i] == first[0] || packs[i] == first[1] || packs[i] == first[2]);
+  hv = amiheader_value(packs[2], Cause);
+  assert_memory_equal (hv->buf, "16", hv->len);
+  for (int i = 0; i < n; i++)
+    amipool_put (pool, packs[i]);
+  amipool_destroy (pool);
+}
+
+static void parse_frames_offsets (void **state)
+{
+  (void)*state;
+  size_t ends[8];
+  const char rcv[] = "Event: FullyBooted\r\n"
+                     "Privilege: system,all\r\n\r\n"
+                     "Response: Success\r\n\r\n"
+                     "\r\n\r\n\r\n"
+                     "Event: Newchannel\r\n"
+                     "Channel: SIP/1001-0000002a\r\n"
+                     "Uniqueid: 1486256739.6071687\r\n\r\n"
+                     "Event: Hang";
+
+  assert_int_equal (amiparse_frames (rcv, sizeof(rcv) - 1, ends, 8), 4);
+  assert_int_equal (ends[0], 45);
+  assert_int_equal (ends[1], 66);
+  assert_int_equal (ends[2], 70);
+  assert_int_equal (ends[3], 151);
+
+  assert_int_equal (amiparse_frames (rcv, sizeof(rcv) - 1, ends, 2), 2);
+  assert_int_equal (ends[1], 66);
+  assert_int_equal (amiparse_frames (rcv, 3, ends, 8), 0);
+  assert_int_equal (amiparse_frames (rcv, 0, ends, 8), 0);
+}
+
+static void parse_frames_positions (void **state)
+{
+  (void)*state;
+  size_t ends[4];
+  char buf[128];
+  int tested = 0;
+
+  // every implementation supported by CPU, not only the one
+  // selected by amiparse_frames
+  for (int impl = FRAME_AUTO; impl <= FRAME_AVX2; impl++) {
+    if (amiparse_frames_impl (buf, 0, ends, 4, impl) < 0)
+      continue;
+    tested++;
+
+    // stanza at every position of buffers of any length
+    for (size_t len = 4; len <= sizeof(buf); len++) {
+      for (size_t at = 0; at + 4 <= len; at++) {
+        memset (buf, 'x', len);
+        buf[0] = '\r';
+        buf[len - 1] = '\r';
+        memcpy (buf + at, "\r\n\r\n", 4);
+        assert_int_equal (amiparse_frames_impl (buf, len, ends, 4, impl), 1);
+        assert_int_equal (ends[0], at + 4);
+      }
+    }
+  }
+  assert_true (tested >= 2);
+}
+
+static void parse_frames_implementations (void **state)
+{
+  (void)*state;
+  size_t ends[64], expect[64];
+  char buf[256];
+  unsigned int seed = 12345;
+  int n;
+
+  // random CR, LF and other bytes: all implementations agree with scalar one
+  for (int round = 0; round < 20000; round++) {
+    size_t len = round % sizeof(buf);
+    for (size_t i = 0; i < len; i++) {
+      seed = seed * 1103515245 + 12345;
+      buf[i] = "\r\n\r\nx"[(seed >> 16) % 5];
+    }
+    n = amiparse_frames_impl (buf, len, expect, 64, FRAME_SCALAR);
+    for (int impl = FRAME_AUTO; impl <= FRAME_AVX2; impl++) {
+      int max = round % 3 ? 64 : 1 + round % 5;
+      int found = amiparse_frames_impl (buf, len, ends, max, impl);
+      if (found < 0)
+        continue;
+      assert_int_equal (found, n < max ? n : max);
+      assert_memory_equal (ends, expect, found * sizeof(size_t));
+    }
+  }
+}
+
+static void parse_registered_headers (void **state)
+{
+  (void)*state;
+  AMIPacket *pack;
+  struct str *hv; // header value
+  AMIHdrSet wanted;
+  int linkedid, language;
+
+  const char str_pack[] = "Event: Newchannel\r\n"
+                          "Channel: SIP/1001-0000002a\r\n"
+                          "linkedid: 1486256739.6071687\r\n"
+                          "Language: en\r\n"
+                          "Uniqueid: 1486256739.6071687\r\n\r\n";
+
+  linkedid = amiheader_register ("Linkedid");
+  language = amiheader_register ("Language");
+  assert_int_equal (linkedid, HDR_CUSTOM);
+  assert_int_equal (language, HDR_CUSTOM + 1);
+  assert_int_equal (amiheader_register ("LINKEDID"), linkedid);
+  assert_int_equal (amiheader_register ("channel"), Channel);
+  assert_int_equal (amiheader_register ("Bad Name"), -1);
+  assert_int_equal (amiheader_register (""), -1);
+  assert_int_equal (header_type_id ("language", 8), language);
+  assert_int_equal (header_type_id ("Lang", 4), HDR_UNKNOWN);
+  assert_string_equal (header_name (linkedid), "Linkedid");
+
+  for (int mode = AMIPACK_HEAP; mode <= AMIPACK_ARENA; mode++) {
+    pack = amiparse_pack_n (str_pack, sizeof(str_pack) - 1, mode);
+    assert_non_null (pack);
+    assert_int_equal (pack->size, 5);
+    assert_true (amipack_has_header(pack, linkedid));
+    assert_false (amipack_has_header(pack, HDR_UNKNOWN));
+    hv = amiheader_value(pack, linkedid);
+    assert_int_equal (hv->len, 18);
+    assert_memory_equal (hv->buf, "1486256739.6071687", hv->len);
+    hv = amiheader_value(pack, language);
+    assert_memory_equal (hv->buf, "en", hv->len);
+    hv = amiheader_value_by_hdr_name(pack, "Linkedid");
+    assert_memory_equal (hv->buf, "1486256739.6071687", hv->len);
+    amipack_destroy (pack);
+  }
+
+  // registered headers are filtered by type
+  amihdrset_clear (&wanted);
+  amihdrset_add (&wanted, language);
+  pack = amiparse_pack_select (str_pack, sizeof(str_pack) - 1, AMIPACK_VIEW, &wanted);
+  assert_non_null (pack);
+  assert_int_equal (pack->size, 1);
+  assert_int_equal (pack->types[0], language);
+  assert_null (amiheader_value(pack, linkedid));
+  amipack_destroy (pack);
+
+  // created packet
+  pack = amipack_init ();
+  amipack_append_unknown (pack, "LINKEDID", "1486256739.6071688");
+  amipack_append (pack, language, "fr");
+  assert_int_equal (pack->head->type, linkedid);
+  assert_string_equal (pack->head->name->buf, "Linkedid");
+  hv = amiheader_value(pack, language);
+  assert_string_equal (hv->buf, "fr");
+  amipack_destroy (pack);
+
+  amiheader_unregister_all ();
+  assert_int_equal (header_type_id ("Linkedid", 8), HDR_UNKNOWN);
+  pack = amipack_init ();
+  assert_int_equal (amipack_append (pack, linkedid, "x"), -1);
+  amipack_destroy (pack);
+}
+
+static void parse_iterate_headers (void **state)
+{
+  (void)*state;
+  AMIPacket *pack;
+  AMIHdrIter iter;
+  struct str *hv; // header value
+  int n;
+
+  const char str_pack[] = "Action: Originate\r\n"
+                          "Channel: SIP/1001\r\n"
+                          "Variable: var1=a\r\n"
+                          "Context: default\r\n"
+                          "Variable: var2=b\r\n"
+                          "Exten: 1002\r\n"
+                          "Variable: var3=c\r\n\r\n";
+  const char *vars[] = { "var1=a", "var2=b", "var3=c" };
+
+  for (int mode = AMIPACK_HEAP; mode <= AMIPACK_ARENA; mode++) {
+    pack = amiparse_pack_n (str_pack, sizeof(str_pack) - 1, mode);
+    assert_non_null (pack);
+
+    n = 0;
+    for (amiheader_iter (&iter, pack, Variable); (hv = amiheader_iter_next (&iter)); n++) {
+      assert_true (n < 3);
+      assert_int_equal (hv->len, 6);
+      assert_memory_equal (hv->buf, vars[n], hv->len);
+    }
+    assert_int_equal (n, 3);
+    assert_null (amiheader_iter_next (&iter));
+
+    amiheader_iter (&iter, pack, Exten);
+    hv = amiheader_iter_next (&iter);
+    assert_memory_equal (hv->buf, "1002", hv->len);
+    assert_null (amiheader_iter_next (&iter));
+
+    amiheader_iter (&iter, pack, Cause);
+    assert_null (amiheader_iter_next (&iter));
+
+    amipack_destroy (pack);
+  }
+}
+
+/*! Allocator failing after limit of allocations. */
+struct alloc_cap {
+  int count;
+  int limit;
+};
+
+static void *cap_alloc (size_t size, void *ud)
+{
+  struct alloc_cap *cap = ud;
+  if (cap->count == cap->limit)
+    return NULL;
+  cap->count++;
+  return malloc (size);
+}
+
+static void *cap_realloc (void *ptr, size_t size, void *ud)
+{
+  struct alloc_cap *cap = ud;
+  if (cap->count == cap->limit)
+    return NULL;
+  cap->count++;
+  return realloc (ptr, size);
+}
+
+static void cap_free (void *ptr, void *ud)
+{
+  (void)ud;
+  free (ptr);
+}
+
+static void parse_custom_allocator (void **state)
+{
+  (void)*state;
+  AMIPacket *pack;
+  struct str *pack_str;
+  struct alloc_cap cap = { 0, -1 };
+  AMIAllocator alloc = { cap_alloc, cap_realloc, cap_free, &cap };
+  int failed = 0;
+
+  const char str_pack[] = "Event: Hangup\r\n"
+                          "Channel: SIP/ipauthTp3BCHH7-00573401-with-long-name\r\n"
+                          "Uniqueid: 1486254977.6071372\r\n"
+                          "Cause-txt: Normal Clearing\r\n\r\n";
+
+  amialloc_set (&alloc);
+
+  // every allocation goes through allocator
+  pack = amiparse_pack (str_pack);
+  assert_non_null (pack);
+  assert_true (cap.count > 0);
+  amipack_destroy (pack);
+
+  // allocation failures are returned, not asserted
+  for (int mode = AMIPACK_HEAP; mode <= AMIPACK_ARENA; mode++) {
+    for (cap.limit = 0; ; cap.limit++) {
+      cap.count = 0;
+      pack = amiparse_pack_n (str_pack, sizeof(str_pack) - 1, mode);
+      if (pack == NULL) {
+        failed++;
+        continue;
+      }
+      cap.limit = -1;
+      pack_str = amipack_to_str (pack);
+      assert_int_equal (pack_str->len, sizeof(str_pack) - 1);
+      str_destroy (pack_str);
+      amipack_destroy (pack);
+      break;
+    }
+  }
+  assert_true (failed >= 4);
+
+  cap.count = 0;
+  cap.limit = 1;
+  pack = amipack_init ();
+  assert_non_null (pack);
+  assert_int_equal (amipack_append (pack, Channel, "SIP/ipauthTp3BCHH7-00573401-with-long-name"), -1);
+  assert_int_equal (pack->size, 0);
+  assert_null (amipack_to_str (pack));
+  amipack_destroy (pack);
+
+  amialloc_set (NULL);
+}
+
+static void parse_arena_allocations (void **state)
+{
+  (void)*state;
+  AMIPacket *pack;
+  struct str *pack_str;
+  struct alloc_cap cap = { 0, -1 };
+  AMIAllocator alloc = { cap_alloc, cap_realloc, cap_free, &cap };
+  char buf[2048];
+  size_t len = 0;
+
+  const char str_pack[] = "Event: Hangup\r\n"
+                          "Channel: SIP/ipauthTp3BCHH7-00573401-with-long-name\r\n"
+                          "Uniqueid: 1486254977.6071372\r\n"
+                          "Cause-txt: Normal Clearing\r\n\r\n";
+
+  amialloc_set (&alloc);
+
+  // arena packet, its slots and first memory block are one allocation
+  pack = amiparse_pack_n (str_pack, sizeof(str_pack) - 1, AMIPACK_ARENA);
+  assert_non_null (pack);
+  assert_int_equal (cap.count, 1);
+  amipack_destroy (pack);
+
+  // slots allocated together with packet grow to allocated array
+  len += sprintf (buf + len, "Event: UserEvent\r\n");
+  for (int i = 0; i < 40; i++)
+    len += sprintf (buf + len, "Variable: var%d=%d\r\n", i, i);
+  len += sprintf (buf + len, "\r\n");
+
+  for (int mode = AMIPACK_HEAP; mode <= AMIPACK_ARENA; mode++) {
+    pack = amiparse_pack_n (buf, len, mode);
+    assert_non_null (pack);
+    assert_int_equal (pack->size, 41);
+    pack_str = amipack_to_str (pack);
+    assert_int_equal (pack_str->len, len);
+    assert_memory_equal (pack_str->buf, buf, len);
+    str_destroy (pack_str);
+    amipack_destroy (pack);
+  }
+
+  amialloc_set (NULL);
+}
+
+static void parse_heap_pool_allocations (void **state)
+{
+  (void)*state;
+  AMIPackPool *pool;
+  AMIPacket *pack;
+  struct str *hv; // header value
+  struct alloc_cap cap = { 0, -1 };
+  AMIAllocator alloc = { cap_alloc, cap_realloc, cap_free, &cap };
+
+  const char str_pack[] = "Event: Hangup\r\n"
+                          "Uniqueid: 1486254977.6071372\r\n"
+                          "X-Custom: 1\r\n"
+                          "Cause-txt: Normal Clearing\r\n\r\n";
+  const char long_pack[] = "Event: Hangup\r\n"
+                           "Channel: SIP/ipauthTp3BCHH7-00573401-with-long-name\r\n\r\n";
+
+  amialloc_set (&alloc);
+  pool = amipool_init (AMIPACK_HEAP, 1);
+
+  pack = amiparse_pack_pool (pool, str_pack, sizeof(str_pack) - 1);
+  assert_non_null (pack);
+  amipool_put (pool, pack);
+
+  // headers of reset heap packet are reused
+  cap.count = 0;
+  pack = amiparse_pack_pool (pool, str_pack, sizeof(str_pack) - 1);
+  assert_non_null (pack);
+  assert_int_equal (cap.count, 0);
+  assert_int_equal (pack->size, 4);
+  hv = amiheader_value (pack, Uniqueid);
+  assert_memory_equal (hv->buf, "1486254977.6071372", hv->len);
+  amipool_put (pool, pack);
+
+  // only long strings are allocated
+  cap.count = 0;
+  pack = amiparse_pack_pool (pool, long_pack, sizeof(long_pack) - 1);
+  assert_non_null (pack);
+  assert_int_equal (cap.count, 1);
+  hv = amiheader_value (pack, Channel);
+  assert_memory_equal (hv->buf, "SIP/ipauthTp3BCHH7-00573401-with-long-name", hv->len);
+  amipool_put (pool, pack);
+
+  amipool_destroy (pool);
+  amialloc_set (NULL);
+}
+
+static void parse_stream_enomem (void **state)
+{
+  (void)*state;
+  AMIStream *stream;
+  AMIPacket *pack, *packs[2];
+  struct alloc_cap cap = { 0, -1 };
+  AMIAllocator alloc = { cap_alloc, cap_realloc, cap_free, &cap };
+  size_t consumed;
+  const char rcv[] = "Asterisk Call Manager/2.10.3\r\n"
+                     "Event: Hangup\r\n"
+                     "Channel: SIP/ipauthTp3BCHH7-00573401-with-long-name\r\n\r\n";
+  const char *packet = rcv + 30;
+
+  amialloc_set (&alloc);
+
+  stream = amistream_init (AMIPACK_HEAP);
+  assert_int_equal (RV_SUCCESS, amistream_feed (stream, rcv, sizeof(rcv) - 1));
+
+  // prompt packet is not allocated
+  cap.count = 0;
+  cap.limit = 0;
+  assert_null (amistream_next (stream));
+  assert_int_equal (stream->enomem, 1);
+  cap.limit = -1;
+  pack = amistream_next (stream);
+  assert_non_null (pack);
+  assert_int_equal (pack->type, AMI_PROMPT);
+  amipack_destroy (pack);
+
+  // packet is allocated, its header is not: packet stays in stream
+  for (int limit = 0; limit < 2; limit++) {
+    cap.count = 0;
+    cap.limit = limit;
+    assert_null (amistream_next (stream));
+    assert_int_equal (stream->enomem, 2 + limit);
+    assert_int_equal (stream->errors, 0);
+  }
+  cap.limit = -1;
+  pack = amistream_next (stream);
+  assert_non_null (pack);
+  assert_int_equal (amipack_event (pack), HangupEvent);
+  amipack_destroy (pack);
+  assert_null (amistream_next (stream));
+  amistream_destroy (stream);
+
+  // batch stops on failed packet and reports it only if nothing is parsed
+  cap.count = 0;
+  cap.limit = 1;
+  assert_int_equal (amiparse_batch (packet, sizeof(rcv) - 31, AMIPACK_HEAP, NULL,
+                                    packs, 2, &consumed), -1);
+  assert_int_equal (consumed, 0);
+  cap.limit = -1;
+  assert_int_equal (amiparse_batch (packet, sizeof(rcv) - 31, AMIPACK_HEAP, NULL,
+                                    packs, 2, &consumed), 1);
+  assert_int_equal (consumed, sizeof(rcv) - 31);
+  amipack_destroy (packs[0]);
+
+  amialloc_set (NULL);
+}
+
+static void parse_pack_shared (void **state)
+{
+  (void)*state;
+  AMIPacket *pack, *consumers[4];
+  struct str *hv; // header value
+
+  const char str_pack[] = "Event: Newchannel\r\n"
+                          "Channel: SIP/1001-0000002a\r\n"
+                          "Linkedid: 1486256739.6071687\r\n"
+                          "Uniqueid: 1486256739.6071687\r\n\r\n";
+
+  pack = amiparse_pack_n (str_pack, sizeof(str_pack) - 1, AMIPACK_LAZY);
+  assert_non_null (pack);
+  assert_int_equal (pack->refs, 1);
+  assert_false (amipack_shared (pack));
+
+  // sharing lazy packet creates headers and names index
+  for (int i = 0; i < 4; i++)
+    consumers[i] = amipack_ref (pack);
+  assert_ptr_equal (consumers[3], pack);
+  assert_int_equal (pack->refs, 5);
+  assert_true (amipack_shared (pack));
+  assert_int_equal (pack->mode, AMIPACK_VIEW);
+  assert_non_null (pack->head);
+  assert_int_equal (pack->names_len, 4);
+
+  // shared packet is immutable
+  assert_int_equal (amipack_append (pack, Exten, "1002"), -1);
+  assert_int_equal (amipack_append_unknown (pack, "X-Custom", "1"), -1);
+  assert_int_equal (amipack_append_n (pack, Exten, NULL, 0, "1002", 4), -1);
+  amipack_reset (pack);
+  assert_int_equal (pack->size, 4);
+
+  amipack_unref (pack);
+  for (int i = 0; i < 3; i++) {
+    hv = amiheader_value_by_hdr_name (consumers[i], "linkedid");
+    assert_memory_equal (hv->buf, "1486256739.6071687", hv->len);
+    amipack_unref (consumers[i]);
+  }
+
+  // last reference makes packet mutable again and destroys it
+  assert_false (amipack_shared (consumers[3]));
+  assert_int_equal (amipack_append (consumers[3], Exten, "1002"), RV_SUCCESS);
+  amipack_unref (consumers[3]);
+}
+
 int main(void)
 {
   const struct CMUnitTest tests[] = {
@@ -525,6 +1662,34 @@ int main(void)
     cmocka_unit_test (parse_pack_command_output),
     cmocka_unit_test (parse_pack_command_output_v2),
     cmocka_unit_test (parse_pack_with_multiple_unknown_headers),
+    cmocka_unit_test (parse_pack_view),
+    cmocka_unit_test (parse_pack_lazy),
+    cmocka_unit_test (parse_pack_arena),
+    cmocka_unit_test (parse_pack_select_headers),
+    cmocka_unit_test (parse_pack_select_command_output),
+    cmocka_unit_test (parse_pack_event_action_types),
+    cmocka_unit_test (parse_pack_view_command_output),
+    cmocka_unit_test (parse_pack_view_invalid),
+    cmocka_unit_test (parse_unknown_header_names),
+    cmocka_unit_test (parse_pack_n_in_buffer),
+    cmocka_unit_test (parse_pack_n_truncated),
+    cmocka_unit_test (parse_pack_n_command_no_end),
+    cmocka_unit_test (parse_stream_chunks),
+    cmocka_unit_test (parse_stream_no_prompt),
+    cmocka_unit_test (parse_stream_skip_events),
+    cmocka_unit_test (parse_stream_pool_prompt),
+    cmocka_unit_test (parse_pack_pool_packets),
+    cmocka_unit_test (parse_batch_buffer),
+    cmocka_unit_test (parse_frames_offsets),
+    cmocka_unit_test (parse_frames_positions),
+    cmocka_unit_test (parse_frames_implementations),
+    cmocka_unit_test (parse_registered_headers),
+    cmocka_unit_test (parse_iterate_headers),
+    cmocka_unit_test (parse_custom_allocator),
+    cmocka_unit_test (parse_arena_allocations),
+    cmocka_unit_test (parse_heap_pool_allocations),
+    cmocka_unit_test (parse_stream_enomem),
+    cmocka_unit_test (parse_pack_shared),
   };
 
   cmocka_set_message_output(CM_OUTPUT_TAP);